@@ -12,6 +12,7 @@ namespace Zappy
 
 ///////////////////////////////////////////////////////////////////////////////
 Application::Application(const std::string& host, int port)
+    : m_settleFrames(SETTLE_FRAMES)
 {
     GameState& state = GameState::GetInstance();
 
@@ -34,13 +35,25 @@ void Application::Update(void)
 {
     GameState& gs = GameState::GetInstance();
 
-    m_renderer->Update();
-    m_renderer->Display();
+    bool hadEvents = m_renderer->Update();
+    bool changed = gs.ConsumeChanged();
 
-    if (gs.HasChanged())
+    if (hadEvents || changed || m_renderer->NeedsFrame())
     {
-        gs.ResetChanged();
+        m_settleFrames = SETTLE_FRAMES;
     }
+    else if (m_settleFrames > 0)
+    {
+        m_settleFrames--;
+    }
+    else if (m_idleClock.getElapsedTime().asMilliseconds() < IDLE_FRAME_INTERVAL)
+    {
+        sf::sleep(sf::milliseconds(IDLE_SLEEP));
+        return;
+    }
+
+    m_idleClock.restart();
+    m_renderer->Display(changed);
 }
 
 } // !namespace Zappy
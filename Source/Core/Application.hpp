@@ -22,11 +22,21 @@ namespace Zappy
 ///////////////////////////////////////////////////////////////////////////////
 class Application
 {
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Constants
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr unsigned int SETTLE_FRAMES = 3;    //<! Frames after activity
+    static constexpr int IDLE_FRAME_INTERVAL = 250;     //<! Idle frame period (ms)
+    static constexpr int IDLE_SLEEP = 10;               //<! Idle polling period (ms)
+
 private:
     ///////////////////////////////////////////////////////////////////////////
     // Private members
     ///////////////////////////////////////////////////////////////////////////
     std::unique_ptr<Renderer> m_renderer;   //<! Renderer for graphics
+    unsigned int m_settleFrames;            //<! Frames left before idling
+    sf::Clock m_idleClock;                  //<! Time since the last frame
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -51,6 +61,11 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Update the application state
     ///
+    /// Frames are only drawn while something happens: window events, game
+    /// state changes or animations, plus a few frames for the GUI to
+    /// settle. Otherwise the call sleeps and a frame is drawn every
+    /// IDLE_FRAME_INTERVAL milliseconds to keep the GUI statistics fresh.
+    ///
     ///////////////////////////////////////////////////////////////////////////
     void Update(void);
 };
@@ -2,14 +2,21 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Game/GameState.hpp"
-#include "Errors/Exception.hpp"
+#include "Errors/NetworkException.hpp"
+#include "Utils/AllocationCounter.hpp"
+#include "Network/Tokenizer.hpp"
 #include <sys/socket.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <chrono>
 #include <random>
-#include <sstream>
 #include <iostream>
+#include <algorithm>
+#include <bit>
+#include <limits>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Zappy
@@ -21,43 +28,41 @@ namespace Zappy
 GameState::GameState()
     : m_socket(AF_INET, SOCK_STREAM)
     , m_isConnected(false)
-    , m_commands({
-        {"msz", std::bind(&GameState::ParseMSZ, this, std::placeholders::_1)},
-        {"bct", std::bind(&GameState::ParseBCT, this, std::placeholders::_1)},
-        {"tna", std::bind(&GameState::ParseTNA, this, std::placeholders::_1)},
-        {"pnw", std::bind(&GameState::ParsePNW, this, std::placeholders::_1)},
-        {"ppo", std::bind(&GameState::ParsePPO, this, std::placeholders::_1)},
-        {"plv", std::bind(&GameState::ParsePLV, this, std::placeholders::_1)},
-        {"pin", std::bind(&GameState::ParsePIN, this, std::placeholders::_1)},
-        {"pex", std::bind(&GameState::ParsePEX, this, std::placeholders::_1)},
-        {"pbc", std::bind(&GameState::ParsePBC, this, std::placeholders::_1)},
-        {"pic", std::bind(&GameState::ParsePIC, this, std::placeholders::_1)},
-        {"pie", std::bind(&GameState::ParsePIE, this, std::placeholders::_1)},
-        {"pfk", std::bind(&GameState::ParsePFK, this, std::placeholders::_1)},
-        {"pdr", std::bind(&GameState::ParsePDR, this, std::placeholders::_1)},
-        {"pgt", std::bind(&GameState::ParsePGT, this, std::placeholders::_1)},
-        {"pdi", std::bind(&GameState::ParsePDI, this, std::placeholders::_1)},
-        {"enw", std::bind(&GameState::ParseENW, this, std::placeholders::_1)},
-        {"ebo", std::bind(&GameState::ParseEBO, this, std::placeholders::_1)},
-        {"edi", std::bind(&GameState::ParseEDI, this, std::placeholders::_1)},
-        {"sgt", std::bind(&GameState::ParseSGT, this, std::placeholders::_1)},
-        {"sst", std::bind(&GameState::ParseSST, this, std::placeholders::_1)},
-        {"seg", std::bind(&GameState::ParseSEG, this, std::placeholders::_1)},
-        {"smg", std::bind(&GameState::ParseSMG, this, std::placeholders::_1)},
-        {"suc", std::bind(&GameState::ParseSUC, this, std::placeholders::_1)},
-        {"sbp", std::bind(&GameState::ParseSBP, this, std::placeholders::_1)}
-    })
     , m_width(0)
     , m_height(0)
     , m_frequency(0)
     , m_livingPlayers(0)
     , m_deadPlayers(0)
+    , m_playersChanged(false)
+    , m_messagesChanged(false)
+    , m_needsRender(false)
+    , m_needsPublish(false)
+    , m_version(0)
+    , m_published(std::make_shared<const Snapshot>())
+    , m_snapshot(m_published)
     , m_hasChanged(false)
     , m_shouldStop(false)
+    , m_wakeFd(eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK))
+    , m_wakeups(0)
+    , m_latencyAverage(0.0)
+    , m_latencyMax(0.0)
+    , m_batchLines(0)
+    , m_batchAllocations(0)
+    , m_publishAllocations(0)
+    , m_parseRate(0.0)
+    , m_malformedLines(0)
+    , m_coalescedAnims(0)
+    , m_droppedAnims(0)
     , m_hasWin(false)
-    , m_winner("No Winner", sf::Color::White)
+    , m_winner(m_published->m_winner)
 {
+    if (m_wakeFd < 0)
+    {
+        throw NetworkException("Failed to create network wake-up event");
+    }
+
     m_totalResources.Reset();
+    m_broadcastSlots.resize(2 * ANIMATION_QUEUE_SIZE);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -65,12 +70,14 @@ GameState::~GameState()
 {
     StopNetworkThread();
     Disconnect();
+    ::close(m_wakeFd);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 bool GameState::Connect(const std::string& host, int port)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    // The network thread is the only one allowed to touch the state
+    StopNetworkThread();
 
     m_host = host;
     m_port = port;
@@ -109,8 +116,6 @@ bool GameState::Connect(const std::string& host, int port)
 ///////////////////////////////////////////////////////////////////////////////
 void GameState::Disconnect(void)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
-
     if (m_isConnected)
     {
         m_socket.Close();
@@ -126,6 +131,10 @@ void GameState::StartNetworkThread(void)
         StopNetworkThread();
     }
 
+    // Drop a wake-up left over by a previous StopNetworkThread
+    std::uint64_t pending;
+    while (::read(m_wakeFd, &pending, sizeof(pending)) > 0);
+
     m_shouldStop = false;
     m_networkThread = std::thread(&GameState::NetworkThreadFunction, this);
 }
@@ -134,8 +143,13 @@ void GameState::StartNetworkThread(void)
 ///////////////////////////////////////////////////////////////////////////////
 void GameState::StopNetworkThread(void)
 {
+    std::uint64_t one = 1;
+
     m_shouldStop = true;
-    m_cv.notify_all();
+    if (::write(m_wakeFd, &one, sizeof(one)) < 0)
+    {
+        std::cerr << "Failed to wake the network thread" << std::endl;
+    }
 
     if (m_networkThread.joinable())
     {
@@ -146,791 +160,1408 @@ void GameState::StopNetworkThread(void)
 ///////////////////////////////////////////////////////////////////////////////
 void GameState::NetworkThreadFunction(void)
 {
-    while (!m_shouldStop && m_isConnected)
-    {
-        try
-        {
-            ProcessNetworkMessages();
+    int epfd = epoll_create1(EPOLL_CLOEXEC);
 
-            // Small sleep to prevent excessive CPU usage
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
-        }
-        catch (const std::exception& e)
-        {
-            std::cerr << "Network thread error: " << e.what() << std::endl;
-            break;
-        }
-    }
-}
-
-///////////////////////////////////////////////////////////////////////////////
-void GameState::ProcessNetworkMessages(void)
-{
-    if (!m_isConnected)
+    if (epfd < 0)
     {
+        std::cerr << "Network thread error: epoll_create1 failed" << std::endl;
         return;
     }
 
-    std::string msg;
-    while (!(msg = m_socket.RecvLine(MSG_DONTWAIT)).empty() && !m_shouldStop)
+    struct epoll_event event = {};
+
+    event.events = EPOLLIN;
+    event.data.fd = m_socket.Get();
+    epoll_ctl(epfd, EPOLL_CTL_ADD, m_socket.Get(), &event);
+    event.data.fd = m_wakeFd;
+    epoll_ctl(epfd, EPOLL_CTL_ADD, m_wakeFd, &event);
+
+    // Lines buffered during the handshake would otherwise wait for the next
+    // packet to arrive
+    ProcessNetworkMessages();
+
+    struct epoll_event events[2];
+    int timeout = PublishIfDue();
+
+    while (!m_shouldStop && m_isConnected && m_socket.IsValid())
     {
-        std::lock_guard<std::recursive_mutex> lock(m_mutex);
+        int count = epoll_wait(epfd, events, 2, timeout);
 
-        auto it = m_commands.find(msg.substr(0, 3));
-        if (it != m_commands.end())
+        if (count < 0)
         {
-            try
+            if (errno == EINTR)
             {
-                it->second(msg.substr(4));
+                continue;
             }
-            catch (...) {}
+            std::cerr << "Network thread error: epoll_wait failed" << std::endl;
+            break;
         }
-    }
 
-    {
-        std::lock_guard<std::recursive_mutex> lock(m_mutex);
-        if (m_messages.size() >= 200)
+        m_wakeups.fetch_add(1, std::memory_order_relaxed);
+
+        for (int i = 0; i < count; i++)
         {
-            size_t removed = 0;
-            for (auto it = m_messages.begin(); it != m_messages.end() && removed < 50;)
+            if (events[i].data.fd != m_wakeFd)
             {
-                if (!it->IsImportant())
+                try
                 {
-                    it = m_messages.erase(it);
-                    ++removed;
+                    ProcessNetworkMessages();
                 }
-                else
+                catch (const std::exception& e)
                 {
-                    ++it;
+                    std::cerr << "Network thread error: " << e.what() << std::endl;
+                    m_shouldStop = true;
                 }
             }
         }
+
+        timeout = PublishIfDue();
     }
-}
 
-///////////////////////////////////////////////////////////////////////////////
-void GameState::Lock(void) const
-{
-    m_mutex.lock();
-}
+    // Lines read right before the connection dropped are still shown
+    if (m_needsPublish)
+    {
+        Publish();
+    }
 
-///////////////////////////////////////////////////////////////////////////////
-void GameState::Unlock(void) const
-{
-    m_mutex.unlock();
+    ::close(epfd);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-std::tuple<unsigned int, unsigned int> GameState::GetDimensions(void) const
+GameState::IngestStatistics GameState::GetIngestStatistics(void) const
 {
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
-    return (std::make_tuple(m_width, m_height));
+    IngestStatistics stats;
+
+    stats.wakeups = m_wakeups.load(std::memory_order_relaxed);
+    stats.latencyAverage = m_latencyAverage.load(std::memory_order_relaxed);
+    stats.latencyMax = m_latencyMax.load(std::memory_order_relaxed);
+    stats.batchLines = m_batchLines.load(std::memory_order_relaxed);
+    stats.batchAllocations = m_batchAllocations.load(std::memory_order_relaxed);
+    stats.publishAllocations =
+        m_publishAllocations.load(std::memory_order_relaxed);
+    stats.parseRate = m_parseRate.load(std::memory_order_relaxed);
+    stats.malformedLines = m_malformedLines.load(std::memory_order_relaxed);
+    for (size_t c = 0; c < stats.errors.size(); ++c)
+    {
+        for (size_t e = 0; e < stats.errors[c].size(); ++e)
+        {
+            stats.errors[c][e] = m_errors[c][e].load(std::memory_order_relaxed);
+        }
+    }
+    stats.coalescedAnimations =
+        m_coalescedAnims.load(std::memory_order_relaxed);
+    stats.droppedAnimations = m_droppedAnims.load(std::memory_order_relaxed);
+
+    return (stats);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-unsigned int GameState::GetWidth(void) const
+const char* GameState::GetCommandName(Command command)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
-    return (m_width);
+    static const std::array<const char*, static_cast<size_t>(Command::Count)>
+        names = {
+            "msz", "bct", "tna", "pnw", "ppo", "plv", "pin", "pex",
+            "pbc", "pic", "pie", "pfk", "pdr", "pgt", "pdi", "enw",
+            "ebo", "edi", "sgt", "sst", "seg", "smg", "suc", "sbp"
+        };
+
+    return (names[static_cast<size_t>(command)]);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-unsigned int GameState::GetHeight(void) const
+const char* GameState::GetErrorName(ParseError error)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
-    return (m_height);
+    static const std::array<const char*, static_cast<size_t>(ParseError::Count)>
+        names = {"Malformed", "Unknown player", "Unknown team"};
+
+    return (names[static_cast<size_t>(error)]);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-const Inventory& GameState::GetTileAt(unsigned int x, unsigned int y) const
+void GameState::ProcessNetworkMessages(void)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
-    if (x >= m_width || y >= m_height || m_tiles.size() <= y * m_width + x)
+    if (!m_isConnected)
     {
-        throw Exception("Invalid tile coordinates");
+        return;
     }
-    return (m_tiles[y * m_width + x]);
-}
 
-///////////////////////////////////////////////////////////////////////////////
-const std::vector<Inventory>& GameState::GetTiles(void) const
-{
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
-    return (m_tiles);
-}
+    using Clock = std::chrono::steady_clock;
+    using Micro = std::chrono::duration<double, std::micro>;
 
-///////////////////////////////////////////////////////////////////////////////
-const std::vector<Team>& GameState::GetTeams(void) const
-{
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
-    return (m_teams);
+    std::string_view line;
+    std::uint64_t allocations = AllocationCounter::GetThreadCount();
+    Clock::time_point received = Clock::now();
+    double latencyTotal = 0.0;
+    double latencyMax = 0.0;
+    unsigned int lines = 0;
+    Clock::duration parseTime = Clock::duration::zero();
+
+    while (true)
+    {
+        while (!m_shouldStop && m_socket.PopLine(line))
+        {
+            Clock::time_point start = Clock::now();
+            double latency = Micro(start - received).count();
+
+            latencyTotal += latency;
+            latencyMax = std::max(latencyMax, latency);
+            lines++;
+
+            Dispatch(
+                line.substr(0, 3),
+                line.size() > 4 ? line.substr(4) : std::string_view()
+            );
+
+            parseTime += Clock::now() - start;
+        }
+
+        if (m_shouldStop || m_socket.Fill(MSG_DONTWAIT) <= 0)
+        {
+            break;
+        }
+        received = Clock::now();
+    }
+
+    if (lines > 0)
+    {
+        m_needsPublish = true;
+        allocations = AllocationCounter::GetThreadCount() - allocations;
+        m_latencyAverage.store(latencyTotal / lines, std::memory_order_relaxed);
+        m_latencyMax.store(latencyMax, std::memory_order_relaxed);
+        m_batchLines.store(lines, std::memory_order_relaxed);
+        m_batchAllocations.store(allocations, std::memory_order_relaxed);
+        m_parseRate.store(
+            lines / std::chrono::duration<double>(parseTime).count(),
+            std::memory_order_relaxed
+        );
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-const std::deque<Message>& GameState::GetMessages(void) const
+int GameState::PublishIfDue(void)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
-    return (m_messages);
+    // Incantation events left over by a full queue belong to a snapshot
+    // already visible, so they are retried without publishing again
+    if (!m_needsPublish)
+    {
+        if (m_pendingAnims.empty())
+        {
+            return (-1);
+        }
+        FlushAnimations();
+        return (m_pendingAnims.empty() ? -1 : PUBLISH_INTERVAL);
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - m_lastPublish
+    ).count();
+
+    // Bursts are coalesced into one snapshot per interval
+    if (elapsed < PUBLISH_INTERVAL)
+    {
+        return (static_cast<int>(PUBLISH_INTERVAL - elapsed));
+    }
+    Publish();
+    return (m_pendingAnims.empty() ? -1 : PUBLISH_INTERVAL);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-const Inventory& GameState::GetTotalResources(void)
+void GameState::Publish(void)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    std::uint64_t allocations = AllocationCounter::GetThreadCount();
+    auto snapshot = std::make_shared<Snapshot>();
+    const Snapshot& previous = *m_published;
+    unsigned int columns = (m_width + REGION_SIZE - 1) / REGION_SIZE;
+    unsigned int rows = (m_height + REGION_SIZE - 1) / REGION_SIZE;
+
+    snapshot->m_version = ++m_version;
+    snapshot->m_width = m_width;
+    snapshot->m_height = m_height;
+    snapshot->m_frequency = m_frequency;
+    snapshot->m_livingPlayers = m_livingPlayers;
+    snapshot->m_deadPlayers = m_deadPlayers;
+    snapshot->m_totalResources = m_totalResources;
+    snapshot->m_hasWin = m_hasWin;
+    snapshot->m_winner = m_winner;
+
+    // Regions holding a changed tile are copied, the others are shared. msz
+    // marks every tile, so resizing the map rebuilds every region.
+    if (m_width == previous.m_width && m_height == previous.m_height)
+    {
+        snapshot->m_regions = previous.m_regions;
+    }
+    else
+    {
+        snapshot->m_regions.resize(static_cast<size_t>(columns) * rows);
+    }
 
-    m_totalResources.Reset();
+    size_t stale = NO_TILE;
 
-    for (const auto& tile : m_tiles)
+    for (size_t word = 0; word < m_changedTiles.size(); ++word)
     {
-        m_totalResources.Add(tile);
+        for (std::uint64_t bits = m_changedTiles[word]; bits; bits &= bits - 1)
+        {
+            size_t tile = word * 64 + std::countr_zero(bits);
+
+            if (tile >= m_tiles.size())
+            {
+                break;
+            }
+
+            size_t region = GetRegionIndex(tile % m_width, tile / m_width);
+
+            // Changed tiles come row by row, skip the region just rebuilt
+            if (region != stale)
+            {
+                snapshot->m_regions[region] = BuildRegion(
+                    region % columns, region / columns
+                );
+                stale = region;
+            }
+        }
     }
 
-    return (m_totalResources);
-}
+    // A changed team only copies its player pointers, the players written
+    // since the last snapshot have already been unshared by EditPlayer
+    snapshot->m_teams = previous.m_teams;
+    snapshot->m_teams.resize(m_teams.size());
+    m_changedTeams.resize(m_teams.size(), true);
+    for (size_t i = 0; i < m_teams.size(); ++i)
+    {
+        if (m_changedTeams[i])
+        {
+            snapshot->m_teams[i] = std::make_shared<const Team>(m_teams[i]);
+            m_changedTeams[i] = false;
+        }
+    }
 
-///////////////////////////////////////////////////////////////////////////////
-void GameState::ResetChanged(void)
-{
-    m_hasChanged = false;
-}
+    if (m_playersChanged)
+    {
+        auto players = std::make_shared<Snapshot::PlayerTable>();
 
-///////////////////////////////////////////////////////////////////////////////
-unsigned int GameState::GetFrequency(void) const
-{
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
-    return (m_frequency);
-}
+        players->reserve(m_players.size());
+        for (const auto& [id, index] : m_players)
+        {
+            players->emplace(id, Snapshot::PlayerLocation{index.team, index.handle});
+        }
+        snapshot->m_players = std::move(players);
+        m_playersChanged = false;
+    }
+    else
+    {
+        snapshot->m_players = previous.m_players;
+    }
 
-///////////////////////////////////////////////////////////////////////////////
-unsigned int GameState::GetLivingPlayers(void) const
-{
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
-    return (m_livingPlayers);
-}
+    // The log is append-only, sharing it copies a few segment pointers
+    if (m_messagesChanged)
+    {
+        snapshot->m_messages = m_messages.Share();
+        m_messagesChanged = false;
+    }
+    else
+    {
+        snapshot->m_messages = previous.m_messages;
+    }
 
-///////////////////////////////////////////////////////////////////////////////
-unsigned int GameState::GetDeadPlayers(void) const
-{
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
-    return (m_deadPlayers);
+    m_published = snapshot;
+    m_snapshot.store(m_published, std::memory_order_release);
+
+    // Tiles and animations are handed over once the snapshot is visible, so
+    // the render thread never reads them ahead of the state they refer to
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_dirtyTiles.size() != m_changedTiles.size())
+        {
+            m_dirtyTiles.assign(m_changedTiles.size(), 0);
+        }
+        for (size_t word = 0; word < m_changedTiles.size(); ++word)
+        {
+            m_dirtyTiles[word] |= m_changedTiles[word];
+        }
+    }
+    std::fill(m_changedTiles.begin(), m_changedTiles.end(), 0);
+    FlushAnimations();
+
+    m_publishAllocations.store(
+        AllocationCounter::GetThreadCount() - allocations,
+        std::memory_order_relaxed
+    );
+    m_lastPublish = std::chrono::steady_clock::now();
+    m_needsPublish = false;
+    if (m_needsRender)
+    {
+        m_needsRender = false;
+        m_hasChanged = true;
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-std::vector<const Player*> GameState::GetPlayersAt(
-    unsigned int x,
-    unsigned int y
-) const
+void GameState::FlushAnimations(void)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    size_t kept = 0;
+    std::uint64_t coalesced = 0;
 
-    std::vector<const Player*> players;
+    // At most half full, the table only grows past a record backlog
+    size_t capacity = std::bit_ceil(2 * m_pendingAnims.size());
 
-    for (const auto& team : m_teams)
+    if (capacity > m_broadcastSlots.size())
     {
-        for (const auto& player : team.GetPlayers())
+        m_broadcastSlots.resize(capacity);
+    }
+    std::fill_n(m_broadcastSlots.begin(), capacity, 0);
+
+    // A broadcast storm raises many identical animations on the same tile,
+    // they are drawn as one whose intensity grows with their number
+    for (const AnimationEvent& event : m_pendingAnims)
+    {
+        if (event.type != AnimationType::Broadcast)
+        {
+            m_pendingAnims[kept++] = event;
+            continue;
+        }
+
+        // Positions are checked against the map, so distinct tiles and
+        // teams never share a key
+        std::uint64_t key =
+            (static_cast<std::uint64_t>(event.y) * m_width + event.x) *
+            m_teams.size() + event.team;
+        size_t slot = (key * 0x9E3779B97F4A7C15ull >> 32) & (capacity - 1);
+
+        while (m_broadcastSlots[slot] != 0)
         {
-            auto [px, py] = player.GetPosition();
+            AnimationEvent& merged = m_pendingAnims[m_broadcastSlots[slot] - 1];
 
-            if (px == x && py == y && player.IsAlive())
+            if (
+                merged.x == event.x && merged.y == event.y &&
+                merged.team == event.team
+            )
             {
-                players.push_back(&player);
+                break;
             }
+            slot = (slot + 1) & (capacity - 1);
+        }
+        if (m_broadcastSlots[slot] != 0)
+        {
+            m_pendingAnims[m_broadcastSlots[slot] - 1].intensity +=
+                event.intensity;
+            coalesced++;
+            continue;
+        }
+        m_broadcastSlots[slot] = static_cast<std::uint32_t>(kept + 1);
+        m_pendingAnims[kept++] = event;
+    }
+    m_pendingAnims.resize(kept);
+
+    size_t pushed = 0;
+
+    while (
+        pushed < m_pendingAnims.size() && m_anims.Push(m_pendingAnims[pushed])
+    )
+    {
+        pushed++;
+    }
+
+    // Overflow: broadcasts are dropped, incantations are retried
+    std::uint64_t dropped = 0;
+
+    kept = 0;
+    for (size_t i = pushed; i < m_pendingAnims.size(); ++i)
+    {
+        if (
+            m_pendingAnims[i].type == AnimationType::Broadcast ||
+            kept == ANIMATION_QUEUE_SIZE
+        )
+        {
+            dropped++;
+            continue;
         }
+        m_pendingAnims[kept++] = m_pendingAnims[i];
+    }
+    m_pendingAnims.resize(kept);
+
+    if (coalesced > 0)
+    {
+        m_coalescedAnims.fetch_add(coalesced, std::memory_order_relaxed);
+    }
+    if (dropped > 0)
+    {
+        m_droppedAnims.fetch_add(dropped, std::memory_order_relaxed);
     }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::shared_ptr<const Snapshot> GameState::GetSnapshot(void) const
+{
+    return (m_snapshot.load(std::memory_order_acquire));
+}
 
-    return (players);
+///////////////////////////////////////////////////////////////////////////////
+Socket::Statistics GameState::GetNetworkStatistics(void) const
+{
+    return (m_socket.GetStatistics());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-bool GameState::HasChanged(void) const
+void GameState::ResetChanged(void)
 {
-    return (m_hasChanged.load());
+    m_hasChanged = false;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-bool GameState::HasWin(void) const
+bool GameState::HasChanged(void) const
 {
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
-    return (m_hasWin);
+    return (m_hasChanged.load());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-const Team& GameState::GetWinner(void) const
+bool GameState::ConsumeChanged(void)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
-    return (m_winner);
+    return (m_hasChanged.exchange(false));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-const std::deque<GameState::AnimationEvent>& GameState::GetAnimationEvents(void) const
+void GameState::ConsumeDirtyTiles(std::vector<std::uint64_t>& dirty)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
-    return (m_anims);
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    dirty.swap(m_dirtyTiles);
+    m_dirtyTiles.assign(dirty.size(), 0);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 std::optional<GameState::AnimationEvent> GameState::PopAnimation(void)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    AnimationEvent event;
 
-    if (m_anims.empty())
+    if (!m_anims.Pop(event))
     {
         return (std::nullopt);
     }
-    AnimationEvent event = m_anims.front();
-    m_anims.pop_front();
     return (std::make_optional(event));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void GameState::ClearAnimationEvents(void)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
-    m_anims.clear();
+    AnimationEvent event;
+
+    while (m_anims.Pop(event))
+    {}
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void GameState::ParseMSZ(const std::string& msg)
+void GameState::Replay(std::string_view lines)
 {
-    std::istringstream iss(msg);
+    while (!lines.empty())
+    {
+        size_t end = std::min(lines.find('\n'), lines.size());
+        std::string_view line = lines.substr(0, end);
 
-    iss >> m_width >> m_height;
-    m_tiles.resize(m_width * m_height);
-    m_hasChanged = true;
+        Dispatch(
+            line.substr(0, 3),
+            line.size() > 4 ? line.substr(4) : std::string_view()
+        );
+        lines.remove_prefix(std::min(end + 1, lines.size()));
+    }
+    Publish();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void GameState::ParseBCT(const std::string& msg)
+GameState::Command GameState::FindCommand(std::string_view name)
 {
-    std::istringstream iss(msg);
-    unsigned int x, y;
+    switch (CommandKey(name))
+    {
+        case CommandKey("msz"): return (Command::MSZ);
+        case CommandKey("bct"): return (Command::BCT);
+        case CommandKey("tna"): return (Command::TNA);
+        case CommandKey("pnw"): return (Command::PNW);
+        case CommandKey("ppo"): return (Command::PPO);
+        case CommandKey("plv"): return (Command::PLV);
+        case CommandKey("pin"): return (Command::PIN);
+        case CommandKey("pex"): return (Command::PEX);
+        case CommandKey("pbc"): return (Command::PBC);
+        case CommandKey("pic"): return (Command::PIC);
+        case CommandKey("pie"): return (Command::PIE);
+        case CommandKey("pfk"): return (Command::PFK);
+        case CommandKey("pdr"): return (Command::PDR);
+        case CommandKey("pgt"): return (Command::PGT);
+        case CommandKey("pdi"): return (Command::PDI);
+        case CommandKey("enw"): return (Command::ENW);
+        case CommandKey("ebo"): return (Command::EBO);
+        case CommandKey("edi"): return (Command::EDI);
+        case CommandKey("sgt"): return (Command::SGT);
+        case CommandKey("sst"): return (Command::SST);
+        case CommandKey("seg"): return (Command::SEG);
+        case CommandKey("smg"): return (Command::SMG);
+        case CommandKey("suc"): return (Command::SUC);
+        case CommandKey("sbp"): return (Command::SBP);
+        default: return (Command::Count);
+    }
+}
 
-    iss >> x >> y;
+///////////////////////////////////////////////////////////////////////////////
+bool GameState::Dispatch(std::string_view name, std::string_view args)
+{
+    static constexpr std::array<
+        ParseResult (GameState::*)(std::string_view),
+        static_cast<size_t>(Command::Count)
+    > parsers =
+    {
+        &GameState::ParseMSZ,
+        &GameState::ParseBCT,
+        &GameState::ParseTNA,
+        &GameState::ParsePNW,
+        &GameState::ParsePPO,
+        &GameState::ParsePLV,
+        &GameState::ParsePIN,
+        &GameState::ParsePEX,
+        &GameState::ParsePBC,
+        &GameState::ParsePIC,
+        &GameState::ParsePIE,
+        &GameState::ParsePFK,
+        &GameState::ParsePDR,
+        &GameState::ParsePGT,
+        &GameState::ParsePDI,
+        &GameState::ParseENW,
+        &GameState::ParseEBO,
+        &GameState::ParseEDI,
+        &GameState::ParseSGT,
+        &GameState::ParseSST,
+        &GameState::ParseSEG,
+        &GameState::ParseSMG,
+        &GameState::ParseSUC,
+        &GameState::ParseSBP
+    };
 
-    if (x >= m_width || y >= m_height)
+    Command command = FindCommand(name);
+
+    if (command == Command::Count)
     {
-        return;
+        return (false);
     }
 
-    unsigned int index = y * m_width + x;
+    ParseResult result = (this->*parsers[static_cast<size_t>(command)])(args);
 
-    m_tiles[index].ParseContent(iss);
-    m_hasChanged = true;
+    if (!result)
+    {
+        m_errors[static_cast<size_t>(command)]
+            [static_cast<size_t>(result.GetError())]
+            .fetch_add(1, std::memory_order_relaxed);
+        if (result.GetError() == ParseError::Malformed)
+        {
+            m_malformedLines.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    return (true);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void GameState::ParseTNA(const std::string& msg)
+GameState::ParseResult GameState::ParseMSZ(std::string_view msg)
 {
-    std::istringstream iss(msg);
-    std::string name;
+    Tokenizer tok(msg);
+    unsigned int width, height;
 
-    iss >> name;
+    if (
+        !tok.ReadUnsigned(width) || !tok.ReadUnsigned(height) ||
+        !tok.AtEnd()
+    )
+    {
+        return (Unexpected(ParseError::Malformed));
+    }
 
-    if (!name.empty())
+    m_width = width;
+    m_height = height;
+    m_tiles.resize(m_width * m_height);
+    m_changedTiles.assign((m_tiles.size() + 63) / 64, ~std::uint64_t(0));
+    if (m_tiles.size() % 64 != 0)
     {
-        sf::Color color = m_teamColors[m_teams.size() % m_teamColors.size()];
-        Team team(name, color);
-        m_teams.push_back(team);
-        m_hasChanged = true;
+        m_changedTiles.back() = (std::uint64_t(1) << (m_tiles.size() % 64)) - 1;
     }
+    RebuildResources();
+
+    // Tile indices depend on the width, so every bucket is rebuilt
+    m_occupants.assign(m_width * m_height, {});
+    for (auto& [id, index] : m_players)
+    {
+        index.tile = NO_TILE;
+        UpdateOccupancy(id);
+    }
+
+    m_needsRender = true;
+    return (ParseResult());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void GameState::ParsePNW(const std::string& msg)
+GameState::ParseResult GameState::ParseBCT(std::string_view msg)
 {
-    Player player(msg);
+    Tokenizer tok(msg);
+    unsigned int x, y;
 
-    const std::string& teamName = player.GetTeam();
+    if (!tok.ReadUnsigned(x) || !tok.ReadUnsigned(y))
+    {
+        return (Unexpected(ParseError::Malformed));
+    }
 
-    for (auto& team : m_teams)
+    if (x >= m_width || y >= m_height)
     {
-        if (team.GetName() == teamName)
-        {
-            team.AddPlayer(player);
-            m_livingPlayers++;
-            m_hasChanged = true;
-            break;
-        }
+        return (Unexpected(ParseError::Malformed));
+    }
+
+    Inventory& tile = m_tiles[y * m_width + x];
+    Inventory& region = m_regionResources[GetRegionIndex(x, y)];
+
+    // Only the difference with the previous content reaches the aggregates
+    m_totalResources.Subtract(tile);
+    region.Subtract(tile);
+
+    bool parsed = tile.ParseContent(tok);
+
+    m_totalResources.Add(tile);
+    region.Add(tile);
+
+    if (!parsed)
+    {
+        return (Unexpected(ParseError::Malformed));
     }
+    MarkDirty(y * m_width + x);
+    m_needsRender = true;
+    return (ParseResult());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void GameState::ParsePPO(const std::string& msg)
+GameState::ParseResult GameState::ParseTNA(std::string_view msg)
 {
-    std::istringstream iss(msg);
+    Tokenizer tok(msg);
+    std::string_view name;
 
-    try {
-        GetPlayerByID(iss).UpdatePosition(iss);
-        m_hasChanged = true;
+    if (!tok.ReadWord(name) || !tok.AtEnd())
+    {
+        return (Unexpected(ParseError::Malformed));
+    }
+
+    if (m_teamIDs.find(name) != m_teamIDs.end())
+    {
+        return (ParseResult());
+    }
+    if (m_teams.size() > std::numeric_limits<Player::TeamID>::max())
+    {
+        return (Unexpected(ParseError::Malformed));
     }
-    catch (...) {}
+
+    Player::TeamID id = static_cast<Player::TeamID>(m_teams.size());
+    sf::Color color = m_teamColors[id % m_teamColors.size()];
+
+    m_teamIDs.emplace(std::string(name), id);
+    m_teams.emplace_back(std::string(name), color);
+    MarkTeamChanged(id);
+    m_needsRender = true;
+    return (ParseResult());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void GameState::ParsePLV(const std::string& msg)
+GameState::ParseResult GameState::ParsePNW(std::string_view msg)
 {
-    std::istringstream iss(msg);
+    Tokenizer tok(msg);
+    unsigned int id, x, y, orientation, level;
+    std::string_view teamName;
+
+    tok.ReadID(id);
+    tok.ReadUnsigned(x);
+    tok.ReadUnsigned(y);
+    tok.ReadUnsigned(orientation);
+    tok.ReadUnsigned(level);
+    tok.ReadWord(teamName);
+
+    if (
+        tok.HasFailed() || !tok.AtEnd() ||
+        orientation < 1 || orientation > Player::ORIENTATION_COUNT ||
+        level < 1 || level > Player::MAX_LEVEL
+    )
+    {
+        return (Unexpected(ParseError::Malformed));
+    }
 
-    try {
-        auto& player = GetPlayerByID(iss);
+    if (m_players.count(id) != 0)
+    {
+        return (Unexpected(ParseError::Malformed));
+    }
 
-        player.UpdateLevel(iss);
-        for (auto& team: m_teams)
-        {
-            if (team.GetName() == player.GetTeam())
-            {
-                team.SetMaxLevel(std::max(team.GetMaxLevel(), player.GetLevel()));
-                break;
-            }
-        }
+    auto it = m_teamIDs.find(teamName);
+
+    if (it == m_teamIDs.end())
+    {
+        return (Unexpected(ParseError::UnknownTeam));
     }
-    catch (...) {}
+
+    Team& team = m_teams[it->second];
+
+    m_players[id] = {
+        it->second,
+        team.AddPlayer(Player(id, x, y, orientation, level, it->second)),
+        NO_TILE,
+        PathHistory()
+    };
+    UpdateOccupancy(id);
+    MarkTeamChanged(it->second);
+    m_playersChanged = true;
+    m_livingPlayers++;
+    m_needsRender = true;
+    return (ParseResult());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void GameState::ParsePIN(const std::string& msg)
+GameState::ParseResult GameState::ParsePPO(std::string_view msg)
 {
-    std::istringstream iss(msg);
+    Tokenizer tok(msg);
+    unsigned int id;
 
-    try { GetPlayerByID(iss).UpdateInventory(iss); }
-    catch (...) {}
+    if (!tok.ReadID(id))
+    {
+        return (Unexpected(ParseError::Malformed));
+    }
+
+    auto found = FindPlayer(id);
+
+    if (!found)
+    {
+        return (Unexpected(found.GetError()));
+    }
+
+    auto [x, y] = found->player.GetPosition();
+
+    if (!found->player.UpdatePosition(tok))
+    {
+        return (Unexpected(ParseError::Malformed));
+    }
+    if (x != found->player.GetX() || y != found->player.GetY())
+    {
+        found->index.path.Push(x, y);
+    }
+    UpdateOccupancy(id);
+    MarkTeamChanged(found->teamIndex);
+    m_needsRender = true;
+    return (ParseResult());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void GameState::ParsePEX(const std::string& msg)
+GameState::ParseResult GameState::ParsePLV(std::string_view msg)
 {
-    std::istringstream iss(msg);
+    Tokenizer tok(msg);
+    unsigned int id;
 
-    try
+    if (!tok.ReadID(id))
     {
-        Player& player = GetPlayerByID(iss);
+        return (Unexpected(ParseError::Malformed));
+    }
 
-        m_messages.emplace_back(
-            player.GetName() + " has left the game.",
-            "Event",
-            "Server",
-            false
-        );
+    auto found = FindPlayer(id);
 
-        for (auto& team : m_teams)
-        {
-            if (team.GetName() == player.GetTeam())
-            {
-                team.RemovePlayer(player);
-                m_livingPlayers--;
-                m_deadPlayers++;
-                m_hasChanged = true;
-                break;
-            }
-        }
+    if (!found)
+    {
+        return (Unexpected(found.GetError()));
+    }
+
+    Player& player = found->player;
+    Team& team = found->team;
+
+    if (!player.UpdateLevel(tok))
+    {
+        return (Unexpected(ParseError::Malformed));
     }
-    catch (...) {}
+    team.SetMaxLevel(std::max(team.GetMaxLevel(), player.GetLevel()));
+    MarkTeamChanged(found->teamIndex);
+    return (ParseResult());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void GameState::ParsePBC(const std::string& msg)
+GameState::ParseResult GameState::ParsePIN(std::string_view msg)
 {
-    std::istringstream iss(msg);
+    Tokenizer tok(msg);
+    unsigned int id;
 
-    try
+    if (!tok.ReadID(id))
     {
-        Player& player = GetPlayerByID(iss);
-        std::string content;
+        return (Unexpected(ParseError::Malformed));
+    }
 
-        std::getline(iss, content);
-        content.erase(0, content.find_first_not_of(' '));
+    auto found = FindPlayer(id);
 
-        m_messages.emplace_back(
-            player.GetName() + ": " + content,
-            "Broadcast",
-            player.GetName(),
-            false
-        );
-        m_hasChanged = true;
+    if (!found)
+    {
+        return (Unexpected(found.GetError()));
+    }
 
-        for (auto& team : m_teams)
-        {
-            if (team.GetName() == player.GetTeam())
-            {
-                m_anims.emplace_back(
-                    AnimationType::Broadcast,
-                    player.GetX(),
-                    player.GetY(),
-                    2.0f,
-                    team
-                );
-                break;
-            }
-        }
+    Player& player = found->player;
+    Inventory before = player.GetInventory();
 
+    if (!player.UpdateInventory(tok))
+    {
+        return (Unexpected(ParseError::Malformed));
     }
-    catch (...) {}
+    found->team.UpdateResources(before, player.GetInventory());
+    MarkTeamChanged(found->teamIndex);
+    return (ParseResult());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void GameState::ParsePIC(const std::string& msg)
+GameState::ParseResult GameState::ParsePEX(std::string_view msg)
 {
-    std::istringstream iss(msg);
-    unsigned int x, y, level;
-    std::vector<unsigned int> ids;
-    std::string idStr;
+    Tokenizer tok(msg);
+    unsigned int id;
 
-    iss >> x >> y >> level;
+    if (!tok.ReadID(id) || !tok.AtEnd())
+    {
+        return (Unexpected(ParseError::Malformed));
+    }
 
-    while (iss >> idStr)
+    if (m_players.count(id) == 0)
     {
-        if (!idStr.empty())
-        {
-            unsigned int id = std::stoi(idStr.substr(1));
-            ids.push_back(id);
-        }
+        return (Unexpected(ParseError::UnknownPlayer));
+    }
+
+    PostMessage(Message(Message::Event::PlayerLeft, id));
+    RemovePlayer(id);
+    return (ParseResult());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+GameState::ParseResult GameState::ParsePBC(std::string_view msg)
+{
+    Tokenizer tok(msg);
+    unsigned int id;
+
+    if (!tok.ReadID(id))
+    {
+        return (Unexpected(ParseError::Malformed));
+    }
+
+    auto it = m_players.find(id);
+
+    if (it == m_players.end())
+    {
+        return (Unexpected(ParseError::UnknownPlayer));
+    }
+
+    // Broadcasting changes nothing, the shared player is only read
+    const Team& team = m_teams[it->second.team];
+    const Player& player = *team.GetPlayer(it->second.handle);
+
+    PostMessage(Message(Message::Event::Broadcast, id), tok.ReadRest());
+    m_needsRender = true;
+
+    // A player placed outside of the map has no tile to animate
+    if (player.GetX() >= m_width || player.GetY() >= m_height)
+    {
+        return (ParseResult());
     }
 
-    m_messages.emplace_back(
-        "Incantation started at (" + std::to_string(x) +
-        ", " + std::to_string(y) + ") for level " +
-        std::to_string(level) + " by Player " + std::to_string(ids[0]),
-        "Incantation",
-        "Server",
-        true
+    m_pendingAnims.emplace_back(
+        AnimationType::Broadcast,
+        player.GetX(),
+        player.GetY(),
+        2.0f,
+        it->second.team,
+        team.GetColor()
     );
+    return (ParseResult());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+GameState::ParseResult GameState::ParsePIC(std::string_view msg)
+{
+    Tokenizer tok(msg);
+    unsigned int x, y, level, id;
+
+    tok.ReadUnsigned(x);
+    tok.ReadUnsigned(y);
+    tok.ReadUnsigned(level);
+    tok.ReadID(id);
+
+    if (
+        tok.HasFailed() || m_teams.empty() ||
+        x >= m_width || y >= m_height
+    )
+    {
+        return (Unexpected(ParseError::Malformed));
+    }
 
-    m_hasChanged = true;
+    PostMessage(Message(Message::Event::IncantationStart, id, x, y, level));
 
-    m_anims.emplace_back(
+    m_needsRender = true;
+
+    m_pendingAnims.emplace_back(
         AnimationType::IncantationStart,
         x,
         y,
         2.0f,
-        m_teams[0]
+        0,
+        m_teams[0].GetColor()
     );
+    return (ParseResult());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void GameState::ParsePIE(const std::string& msg)
+GameState::ParseResult GameState::ParsePIE(std::string_view msg)
 {
-    std::istringstream iss(msg);
+    Tokenizer tok(msg);
     unsigned int x, y;
-    std::string result;
+    std::string_view result;
 
-    iss >> x >> y >> result;
+    tok.ReadUnsigned(x);
+    tok.ReadUnsigned(y);
+    tok.ReadWord(result);
 
-    m_messages.emplace_back(
-        "Incantation ended at (" + std::to_string(x) + ", " +
-        std::to_string(y) + ") with result: " + result,
-        "Incantation",
-        "Server",
-        true
-    );
-    m_hasChanged = true;
+    if (
+        tok.HasFailed() || !tok.AtEnd() || m_teams.empty() ||
+        x >= m_width || y >= m_height
+    )
+    {
+        return (Unexpected(ParseError::Malformed));
+    }
 
-    m_anims.emplace_back(
+    PostMessage(Message(Message::Event::IncantationEnd, 0, x, y), result);
+    m_needsRender = true;
+
+    m_pendingAnims.emplace_back(
         result == "1"
             ? AnimationType::IncantationSuccess
             : AnimationType::IncantationFail,
         x, y,
         2.0f,
-        m_teams[0]
+        0,
+        m_teams[0].GetColor()
     );
+    return (ParseResult());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void GameState::ParsePFK(const std::string& msg)
+GameState::ParseResult GameState::ParsePFK(std::string_view msg)
 {
-    std::istringstream iss(msg);
+    Tokenizer tok(msg);
+    unsigned int id;
 
-    try
+    if (!tok.ReadID(id) || !tok.AtEnd())
     {
-        Player& player = GetPlayerByID(iss);
-        m_messages.emplace_back(
-            player.GetName() + " is laying an egg",
-            "Egg",
-            player.GetName(),
-            false
-        );
+        return (Unexpected(ParseError::Malformed));
     }
-    catch (...) {}
+
+    if (m_players.count(id) == 0)
+    {
+        return (Unexpected(ParseError::UnknownPlayer));
+    }
+
+    PostMessage(Message(Message::Event::EggLaying, id));
+    return (ParseResult());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void GameState::ParsePDR(const std::string& msg)
+GameState::ParseResult GameState::ParsePDR(std::string_view msg)
 {
-    std::istringstream iss(msg);
-    unsigned int index;
+    Tokenizer tok(msg);
+    unsigned int id, index;
 
-    static const std::vector<std::string> resources =
-    {
-        "food",
-        "linemate", "deraumere", "sibur",
-        "mendiane", "phiras", "thystame"
-    };
+    tok.ReadID(id);
+    tok.ReadUnsigned(index);
 
-    try
+    if (
+        tok.HasFailed() || !tok.AtEnd() ||
+        index >= Inventory::RESOURCE_COUNT
+    )
     {
-        Player& player = GetPlayerByID(iss);
-
-        iss >> index;
+        return (Unexpected(ParseError::Malformed));
+    }
 
-        m_messages.emplace_back(
-            player.GetName() + " has dropped a resource: " + resources[index],
-            "Resource",
-            player.GetName(),
-            false
-        );
+    if (m_players.count(id) == 0)
+    {
+        return (Unexpected(ParseError::UnknownPlayer));
     }
-    catch (...) {}
+
+    PostMessage(Message(Message::Event::ResourceDrop, id, 0, 0, index));
+    return (ParseResult());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void GameState::ParsePGT(const std::string& msg)
+GameState::ParseResult GameState::ParsePGT(std::string_view msg)
 {
-    std::istringstream iss(msg);
-    unsigned int index;
+    Tokenizer tok(msg);
+    unsigned int id, index;
 
-    static const std::vector<std::string> resources =
-    {
-        "food",
-        "linemate", "deraumere", "sibur",
-        "mendiane", "phiras", "thystame"
-    };
+    tok.ReadID(id);
+    tok.ReadUnsigned(index);
 
-    try
+    if (
+        tok.HasFailed() || !tok.AtEnd() ||
+        index >= Inventory::RESOURCE_COUNT
+    )
     {
-        Player& player = GetPlayerByID(iss);
-
-        iss >> index;
+        return (Unexpected(ParseError::Malformed));
+    }
 
-        m_messages.emplace_back(
-            player.GetName() + " has taken a resource: " + resources[index],
-            "Resource",
-            player.GetName(),
-            false
-        );
+    if (m_players.count(id) == 0)
+    {
+        return (Unexpected(ParseError::UnknownPlayer));
     }
-    catch (...) {}
+
+    PostMessage(Message(Message::Event::ResourceTake, id, 0, 0, index));
+    return (ParseResult());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void GameState::ParsePDI(const std::string& msg)
+GameState::ParseResult GameState::ParsePDI(std::string_view msg)
 {
-    std::istringstream iss(msg);
+    Tokenizer tok(msg);
+    unsigned int id;
 
-    try
+    if (!tok.ReadID(id) || !tok.AtEnd())
     {
-        Player& player = GetPlayerByID(iss);
+        return (Unexpected(ParseError::Malformed));
+    }
 
-        player.SetAlive(false);
+    if (m_players.count(id) == 0)
+    {
+        return (Unexpected(ParseError::UnknownPlayer));
+    }
 
-        m_messages.emplace_back(
-            player.GetName() + " died",
-            "Death",
-            "Server",
-            false
-        );
+    PostMessage(Message(Message::Event::Death, id));
+    RemovePlayer(id);
+    return (ParseResult());
+}
 
-        for (auto& team : m_teams)
-        {
-            if (team.GetName() == player.GetTeam())
-            {
-                team.RemovePlayer(player);
-                m_livingPlayers--;
-                m_deadPlayers++;
-                m_hasChanged = true;
-                break;
-            }
-        }
+///////////////////////////////////////////////////////////////////////////////
+GameState::ParseResult GameState::ParseENW(std::string_view msg)
+{
+    Tokenizer tok(msg);
+    unsigned int id, playerID, x, y;
+
+    tok.ReadID(id);
+    tok.ReadID(playerID);
+    tok.ReadUnsigned(x);
+    tok.ReadUnsigned(y);
+
+    if (tok.HasFailed() || !tok.AtEnd())
+    {
+        return (Unexpected(ParseError::Malformed));
     }
-    catch (...) {}
+
+    if (m_players.count(playerID) == 0)
+    {
+        return (Unexpected(ParseError::UnknownPlayer));
+    }
+
+    PostMessage(Message(Message::Event::EggLaid, playerID, x, y, id));
+    return (ParseResult());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void GameState::ParseENW(const std::string& msg)
+GameState::ParseResult GameState::ParseEBO(std::string_view msg)
 {
-    std::istringstream iss(msg);
-    std::string eggStr;
-    unsigned int x, y;
-
-    iss >> eggStr;
+    Tokenizer tok(msg);
+    unsigned int id;
 
-    try
+    if (!tok.ReadID(id) || !tok.AtEnd())
     {
-        Player& player = GetPlayerByID(iss);
+        return (Unexpected(ParseError::Malformed));
+    }
 
-        unsigned int id = std::stoi(eggStr.substr(1));
-        iss >> x >> y;
+    PostMessage(Message(Message::Event::EggHatched, 0, 0, 0, id));
+    return (ParseResult());
+}
 
-        m_messages.emplace_back(
-            "Egg " + std::to_string(id) + " laid by Player " +
-            std::to_string(player.GetID()) + " at (" +
-            std::to_string(x) + ", " + std::to_string(y) + ")",
-            "Egg",
-            player.GetName(),
-            false
-        );
+///////////////////////////////////////////////////////////////////////////////
+GameState::ParseResult GameState::ParseEDI(std::string_view msg)
+{
+    Tokenizer tok(msg);
+    unsigned int id;
+
+    if (!tok.ReadID(id) || !tok.AtEnd())
+    {
+        return (Unexpected(ParseError::Malformed));
     }
-    catch (...) {}
+
+    PostMessage(Message(Message::Event::EggDestroyed, 0, 0, 0, id));
+    return (ParseResult());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void GameState::ParseEBO(const std::string& msg)
+GameState::ParseResult GameState::ParseSGT(std::string_view msg)
 {
-    std::istringstream iss(msg);
-    std::string eggStr;
+    Tokenizer tok(msg);
+    unsigned int frequency;
 
-    iss >> eggStr;
+    if (!tok.ReadUnsigned(frequency) || !tok.AtEnd())
+    {
+        return (Unexpected(ParseError::Malformed));
+    }
+    m_frequency = frequency;
+    return (ParseResult());
+}
 
-    unsigned int id = std::stoi(eggStr.substr(1));
+///////////////////////////////////////////////////////////////////////////////
+GameState::ParseResult GameState::ParseSST(std::string_view msg)
+{
+    Tokenizer tok(msg);
+    unsigned int frequency;
 
-    m_messages.emplace_back(
-        "Egg " + std::to_string(id) + " has been hatched",
-        "Egg",
-        "Server",
-        false
-    );
+    if (!tok.ReadUnsigned(frequency) || !tok.AtEnd())
+    {
+        return (Unexpected(ParseError::Malformed));
+    }
+    m_frequency = frequency;
+    return (ParseResult());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void GameState::ParseEDI(const std::string& msg)
+GameState::ParseResult GameState::ParseSEG(std::string_view msg)
 {
-    std::istringstream iss(msg);
-    std::string eggStr;
+    Tokenizer tok(msg);
+    std::string_view teamName;
 
-    iss >> eggStr;
+    if (!tok.ReadWord(teamName) || !tok.AtEnd())
+    {
+        return (Unexpected(ParseError::Malformed));
+    }
 
-    unsigned int id = std::stoi(eggStr.substr(1));
+    PostMessage(Message(Message::Event::Victory), teamName);
+    m_needsRender = true;
 
-    m_messages.emplace_back(
-        "Egg " + std::to_string(id) + " has been destroyed",
-        "Egg",
-        "Server",
-        false
-    );
+    m_hasWin = true;
+
+    auto it = m_teamIDs.find(teamName);
+
+    if (it != m_teamIDs.end())
+    {
+        m_winner = std::make_shared<const Team>(m_teams[it->second]);
+    }
+    return (ParseResult());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void GameState::ParseSGT(const std::string& msg)
+GameState::ParseResult GameState::ParseSMG(std::string_view msg)
 {
-    std::istringstream iss(msg);
+    Tokenizer tok(msg);
 
-    iss >> m_frequency;
+    PostMessage(Message(Message::Event::ServerMessage), tok.ReadRest());
+    return (ParseResult());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void GameState::ParseSST(const std::string& msg)
+GameState::ParseResult GameState::ParseSUC(std::string_view msg)
 {
-    std::istringstream iss(msg);
+    Tokenizer tok(msg);
 
-    iss >> m_frequency;
+    PostMessage(Message(Message::Event::UnknownCommand), tok.ReadRest());
+    return (ParseResult());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void GameState::ParseSEG(const std::string& msg)
+GameState::ParseResult GameState::ParseSBP(std::string_view msg)
 {
-    std::istringstream iss(msg);
-    std::string teamName;
+    Tokenizer tok(msg);
+    std::string_view command, params;
+
+    if (!tok.ReadWord(command))
+    {
+        return (ParseResult());
+    }
+
+    params = tok.ReadRest();
 
-    iss >> teamName;
+    if (params.empty())
+    {
+        return (ParseResult());
+    }
 
-    m_messages.emplace_back(
-        "Team " + teamName + " has won the game!",
-        "Victory",
-        "Server",
-        true
+    // The command and its parameters are contiguous in the line
+    PostMessage(
+        Message(Message::Event::BadParameter),
+        std::string_view(
+            command.data(), params.data() + params.size() - command.data()
+        )
     );
-    m_hasChanged = true;
+    return (ParseResult());
+}
 
-    m_hasWin = true;
-    for (auto& team : m_teams)
+///////////////////////////////////////////////////////////////////////////////
+void GameState::PostMessage(const Message& message, std::string_view payload)
+{
+    m_messages.Push(message, payload);
+    m_messagesChanged = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void GameState::MarkTeamChanged(size_t team)
+{
+    if (m_changedTeams.size() <= team)
     {
-        if (team.GetName() == teamName)
-        {
-            m_winner = team;
-            break;
-        }
+        m_changedTeams.resize(team + 1, true);
     }
+    m_changedTeams[team] = true;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void GameState::ParseSMG(const std::string& msg)
+Expected<GameState::PlayerRef, GameState::ParseError> GameState::FindPlayer(
+    unsigned int id
+)
 {
-    std::istringstream iss(msg);
-    std::string content;
+    auto it = m_players.find(id);
+
+    if (it == m_players.end())
+    {
+        return (Unexpected(ParseError::UnknownPlayer));
+    }
 
-    std::getline(iss, content);
-    content.erase(0, content.find_first_not_of(' '));
+    Team& team = m_teams[it->second.team];
 
-    m_messages.emplace_back(
-        content,
-        "Info",
-        "Server",
-        false
-    );
+    return (PlayerRef{
+        *team.EditPlayer(it->second.handle), team, it->second.team, it->second
+    });
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void GameState::ParseSUC(const std::string& msg)
+void GameState::RemovePlayer(unsigned int id)
 {
-    std::istringstream iss(msg);
-    std::string command;
+    auto it = m_players.find(id);
+
+    if (it == m_players.end())
+    {
+        return;
+    }
 
-    std::getline(iss, command);
-    command.erase(0, command.find_first_not_of(' '));
+    ClearOccupancy(id, it->second);
 
-    m_messages.emplace_back(
-        "Unknown command: " + command,
-        "Error",
-        "Server",
-        false
-    );
+    PlayerIndex index = it->second;
+
+    m_teams[index.team].RemovePlayer(index.handle);
+    m_players.erase(it);
+    MarkTeamChanged(index.team);
+    m_playersChanged = true;
+
+    m_livingPlayers--;
+    m_deadPlayers++;
+    m_needsRender = true;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void GameState::ParseSBP(const std::string& msg)
+void GameState::UpdateOccupancy(unsigned int id)
 {
-    std::istringstream iss(msg);
-    std::string command, params;
+    PlayerIndex& index = m_players.find(id)->second;
+    auto [x, y] = m_teams[index.team].GetPlayer(index.handle)->GetPosition();
+    size_t tile = NO_TILE;
 
-    iss >> command;
+    if (x < m_width && y < m_height)
+    {
+        tile = static_cast<size_t>(y) * m_width + x;
+    }
 
-    std::getline(iss, params);
-    params.erase(0, params.find_first_not_of(' '));
+    // The player may have turned without moving
+    MarkDirty(tile);
 
-    if (params.empty() || command.empty())
+    if (tile == index.tile)
     {
         return;
     }
-    m_messages.emplace_back(
-        "Bad parameter for command: " + command + " " + params,
-        "Error",
-        "Server",
-        false
-    );
+
+    ClearOccupancy(id, index);
+    if (tile != NO_TILE)
+    {
+        m_occupants[tile].push_back(id);
+    }
+    index.tile = tile;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-Player& GameState::GetPlayerByID(std::istringstream& iss)
+size_t GameState::GetRegionIndex(unsigned int x, unsigned int y) const
 {
-    std::string idStr;
+    unsigned int columns = (m_width + REGION_SIZE - 1) / REGION_SIZE;
+
+    return (static_cast<size_t>(y / REGION_SIZE) * columns + x / REGION_SIZE);
+}
 
-    iss >> idStr;
+///////////////////////////////////////////////////////////////////////////////
+void GameState::RebuildResources(void)
+{
+    unsigned int columns = (m_width + REGION_SIZE - 1) / REGION_SIZE;
+    unsigned int rows = (m_height + REGION_SIZE - 1) / REGION_SIZE;
+
+    m_totalResources.Reset();
+    m_regionResources.assign(columns * rows, Inventory());
 
-    if (!idStr.empty())
+    for (unsigned int y = 0; y < m_height; ++y)
     {
-        unsigned int id = std::stoi(idStr.substr(1));
+        for (unsigned int x = 0; x < m_width; ++x)
+        {
+            const Inventory& tile = m_tiles[y * m_width + x];
 
-        for (auto& team : m_teams)
+            m_totalResources.Add(tile);
+            m_regionResources[GetRegionIndex(x, y)].Add(tile);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::shared_ptr<const Snapshot::Region> GameState::BuildRegion(
+    unsigned int column,
+    unsigned int row
+) const
+{
+    static constexpr unsigned int AREA = REGION_SIZE * REGION_SIZE;
+
+    auto region = std::make_shared<Snapshot::Region>();
+    unsigned int left = column * REGION_SIZE;
+    unsigned int top = row * REGION_SIZE;
+
+    region->tiles.resize(AREA);
+    region->offsets.resize(AREA + 1);
+    region->resources = m_regionResources[GetRegionIndex(left, top)];
+
+    for (unsigned int i = 0; i < AREA; ++i)
+    {
+        unsigned int x = left + i % REGION_SIZE;
+        unsigned int y = top + i / REGION_SIZE;
+
+        region->offsets[i] = static_cast<unsigned int>(region->occupants.size());
+        if (x >= m_width || y >= m_height)
         {
-            for (auto& player : team.GetPlayers())
-            {
-                if (player.GetID() == id)
-                {
-                    return (player);
-                }
-            }
+            continue;
         }
+
+        size_t tile = static_cast<size_t>(y) * m_width + x;
+
+        region->tiles[i] = m_tiles[tile];
+        region->occupants.insert(
+            region->occupants.end(),
+            m_occupants[tile].begin(),
+            m_occupants[tile].end()
+        );
+    }
+    region->offsets[AREA] = static_cast<unsigned int>(region->occupants.size());
+    return (region);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void GameState::ClearOccupancy(unsigned int id, PlayerIndex& index)
+{
+    if (index.tile == NO_TILE)
+    {
+        return;
     }
 
-    throw Exception("Player not found");
+    auto& occupants = m_occupants[index.tile];
+
+    occupants.erase(std::find(occupants.begin(), occupants.end(), id));
+    MarkDirty(index.tile);
+    index.tile = NO_TILE;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void GameState::MarkDirty(size_t tile)
+{
+    if (tile == NO_TILE)
+    {
+        return;
+    }
+    m_changedTiles[tile / 64] |= std::uint64_t(1) << (tile % 64);
 }
 
 } // !namespace Zappy
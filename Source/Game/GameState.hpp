@@ -9,20 +9,27 @@
 #include "Network/Socket.hpp"
 #include "Game/Inventory.hpp"
 #include "Game/Team.hpp"
-#include "Graphics/Animations/Animation.hpp"
 #include "Utils/Singleton.hpp"
-#include "Game/Message.hpp"
+#include "Utils/Expected.hpp"
+#include "Utils/SpscQueue.hpp"
+#include "Game/MessageLog.hpp"
+#include "Game/PathHistory.hpp"
+#include "Game/Snapshot.hpp"
+#include <SFML/Graphics/Color.hpp>
 #include <vector>
-#include <unordered_map>
 #include <string>
-#include <functional>
-#include <sstream>
-#include <deque>
+#include <string_view>
 #include <tuple>
 #include <mutex>
 #include <atomic>
-#include <condition_variable>
+#include <chrono>
+#include <cstdint>
+#include <thread>
 #include <optional>
+#include <unordered_map>
+#include <memory>
+#include <array>
+#include <functional>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Zappy
@@ -51,48 +58,61 @@ public:
 
 public:
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Commands of the graphical protocol, in dispatch order
     ///
     ///////////////////////////////////////////////////////////////////////////
-    class ScopedLock
+    enum class Command : std::uint8_t
     {
-    private:
-        ///////////////////////////////////////////////////////////////////////
-        // Private members
-        ///////////////////////////////////////////////////////////////////////
-        const GameState& m_gameState;
-
-    public:
-        ///////////////////////////////////////////////////////////////////////
-        /// \brief
-        ///
-        /// \param gs The GameState instance to lock
-        ///
-        ///////////////////////////////////////////////////////////////////////
-        explicit ScopedLock(const GameState& gs)
-            : m_gameState(gs)
-        {
-            m_gameState.Lock();
-        }
+        MSZ, BCT, TNA, PNW, PPO, PLV, PIN, PEX, PBC, PIC, PIE, PFK,
+        PDR, PGT, PDI, ENW, EBO, EDI, SGT, SST, SEG, SMG, SUC, SBP,
+        Count
+    };
 
-        ///////////////////////////////////////////////////////////////////////
-        /// \brief Destructor
-        ///
-        ///////////////////////////////////////////////////////////////////////
-        ~ScopedLock()
-        {
-            m_gameState.Unlock();
-        }
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Reasons for a parser to reject a line
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    enum class ParseError : std::uint8_t
+    {
+        Malformed,                  //<! Missing or invalid field
+        UnknownPlayer,              //<! No living player has the ID
+        UnknownTeam,                //<! No team has the name
+        Count
     };
 
-private:
     ///////////////////////////////////////////////////////////////////////////
-    // Type alias for command functions
+    // Rejected lines by command and by error
     ///////////////////////////////////////////////////////////////////////////
-    using Command = std::function<void(const std::string&)>;
+    using CommandErrors = std::array<
+        std::array<std::uint64_t, static_cast<size_t>(ParseError::Count)>,
+        static_cast<size_t>(Command::Count)
+    >;
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Counters describing the network thread activity
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct IngestStatistics
+    {
+        std::uint64_t wakeups;      //<! Number of network thread wake-ups
+        double latencyAverage;      //<! Mean recv-to-dispatch latency (us)
+        double latencyMax;          //<! Worst recv-to-dispatch latency (us)
+        unsigned int batchLines;    //<! Lines dispatched in the last batch
+        std::uint64_t batchAllocations; //<! Dispatch allocations, last batch
+        std::uint64_t publishAllocations; //<! Allocations of the last Publish
+        double parseRate;           //<! Lines parsed per second of parse time
+        std::uint64_t malformedLines;   //<! Lines rejected by their parser
+        CommandErrors errors;       //<! Rejected lines by command and error
+        std::uint64_t coalescedAnimations; //<! Broadcasts merged on publish
+        std::uint64_t droppedAnimations;   //<! Events lost to a full queue
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Animation requested by the network thread
+    ///
+    /// Events only hold values, so they stay valid once the team or player
+    /// they were raised for is gone.
     ///
     ///////////////////////////////////////////////////////////////////////////
     struct AnimationEvent
@@ -101,21 +121,30 @@ private:
         ///////////////////////////////////////////////////////////////////////
         // Public: members
         ///////////////////////////////////////////////////////////////////////
-        AnimationType type;
-        unsigned int x;
-        unsigned int y;
-        float duration;
-        const Team& team;
+        AnimationType type;             //<! Kind of animation
+        unsigned int x;                 //<! X coordinate of the tile
+        unsigned int y;                 //<! Y coordinate of the tile
+        float duration;                 //<! Duration in seconds
+        size_t team;                    //<! Index of the team in m_teams
+        sf::Color color;                //<! Color of the team
+        unsigned int intensity;         //<! Number of events merged into it
 
     public:
         ///////////////////////////////////////////////////////////////////////
-        /// \brief
+        /// \brief Default constructor, for the slots of the event queue
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        AnimationEvent(void) = default;
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Constructor of an animation event
         ///
-        /// \param t
-        /// \param posX
-        /// \param posY
-        /// \param dur
-        /// \param team
+        /// \param t The kind of animation
+        /// \param posX The x-coordinate of the tile
+        /// \param posY The y-coordinate of the tile
+        /// \param dur The duration in seconds
+        /// \param teamIndex The index of the team in m_teams
+        /// \param col The color of the team
         ///
         ///////////////////////////////////////////////////////////////////////
         AnimationEvent(
@@ -123,16 +152,91 @@ private:
             unsigned int posX,
             unsigned int posY,
             float dur,
-            const Team& team
+            size_t teamIndex,
+            const sf::Color& col
         )
             : type(t)
             , x(posX)
             , y(posY)
             , duration(dur)
-            , team(team)
+            , team(teamIndex)
+            , color(col)
+            , intensity(1)
             {}
     };
 
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Location of a player inside the team storage
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct PlayerIndex
+    {
+        size_t team;                    //<! Index of the team in m_teams
+        Team::PlayerHandle handle;      //<! Handle of the player in the team
+        size_t tile;                    //<! Occupied tile, NO_TILE if none
+        PathHistory path;               //<! Tiles left, never published
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Tile index of players standing outside of the map
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t NO_TILE = static_cast<size_t>(-1);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Outcome of a parser
+    ///////////////////////////////////////////////////////////////////////////
+    using ParseResult = Expected<void, ParseError>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Living player found through the ID index
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct PlayerRef
+    {
+        Player& player;                 //<! The player, unshared for writing
+        Team& team;                     //<! The team of the player
+        size_t teamIndex;               //<! Index of the team in m_teams
+        PlayerIndex& index;             //<! The entry of the ID index
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Hash allowing team names to be looked up by string_view
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct NameHash
+    {
+        using is_transparent = void;
+
+        size_t operator()(std::string_view name) const
+        {
+            return (std::hash<std::string_view>()(name));
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Team IDs by name, with heterogeneous lookup
+    ///////////////////////////////////////////////////////////////////////////
+    using TeamTable = std::unordered_map<
+        std::string, Player::TeamID, NameHash, std::equal_to<>
+    >;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Side length in tiles of the regions aggregating resources
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr unsigned int REGION_SIZE = Snapshot::REGION_SIZE;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Minimum delay in milliseconds between two published snapshots
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr int PUBLISH_INTERVAL = 4;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Capacity of the queue of animation events waiting to be rendered
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t ANIMATION_QUEUE_SIZE = 1024;
+
 private:
     ///////////////////////////////////////////////////////////////////////////
     // Private members
@@ -143,27 +247,56 @@ private:
     int m_port;                         //<! Port number for the game server
     std::vector<Inventory> m_tiles;     //<! Tiles in the game state
     std::vector<Team> m_teams;          //<! Teams in the game state
-    std::unordered_map<
-        std::string,                    //<! Command name
-        Command                         //<! Command function
-    > m_commands;                       //<! Commands for the game state
+    TeamTable m_teamIDs;                //<! Team IDs by name
+    std::unordered_map<unsigned int, PlayerIndex> m_players; //<! Players by ID
+    std::vector<std::vector<unsigned int>> m_occupants; //<! Player IDs by tile
     unsigned int m_width;               //<! Width of the game map
     unsigned int m_height;              //<! Height of the game map
-    std::deque<Message> m_messages;     //<! Messages in the game state
+    MessageLog m_messages;              //<! Messages in the game state
     unsigned int m_frequency;           //<! Frequency of the game updates
     unsigned int m_livingPlayers;       //<! Number of living players
     unsigned int m_deadPlayers;         //<! Number of dead players
     Inventory m_totalResources;         //<! Total resources in the game state
+    std::vector<Inventory> m_regionResources; //<! Resources per map region
+    std::vector<std::uint64_t> m_changedTiles; //<! Tiles changed since publishing
+    std::vector<bool> m_changedTeams;   //<! Teams changed since publishing
+    bool m_playersChanged;              //<! A player joined or left since publishing
+    bool m_messagesChanged;             //<! A message was posted since publishing
+    bool m_needsRender;                 //<! Unpublished change worth a new frame
+    bool m_needsPublish;                //<! Lines were dispatched since publishing
+    std::chrono::steady_clock::time_point m_lastPublish; //<! Last publication
+    std::uint64_t m_version;            //<! Version of the last snapshot
+    std::shared_ptr<const Snapshot> m_published; //<! Last snapshot, writer side
+    std::atomic<std::shared_ptr<const Snapshot>> m_snapshot; //<! Last snapshot
     std::atomic<bool> m_hasChanged;     //<! Indicate if the game state has changed
 
-    mutable std::recursive_mutex m_mutex; //<! Mutex for thread safety
+    mutable std::mutex m_mutex;         //<! Guards the dirty tiles
+    std::vector<std::uint64_t> m_dirtyTiles; //<! One bit per tile changed
     std::thread m_networkThread;        //<! Thread for network communication
     std::atomic<bool> m_shouldStop;     //<! Indicate if the network thread should stop
-    std::condition_variable_any m_cv;   //<! Condition variable for synchronization
+    int m_wakeFd;                       //<! eventfd used to wake the network thread
+    std::atomic<std::uint64_t> m_wakeups;   //<! Network thread wake-up count
+    std::atomic<double> m_latencyAverage;   //<! Mean recv-to-dispatch latency (us)
+    std::atomic<double> m_latencyMax;       //<! Worst recv-to-dispatch latency (us)
+    std::atomic<unsigned int> m_batchLines; //<! Lines dispatched in the last batch
+    std::atomic<std::uint64_t> m_batchAllocations; //<! Allocations in the last batch
+    std::atomic<std::uint64_t> m_publishAllocations; //<! In the last Publish
+    std::atomic<double> m_parseRate;        //<! Parser throughput of the last batch
+    std::atomic<std::uint64_t> m_malformedLines; //<! Lines rejected by their parser
+    std::array<
+        std::array<
+            std::atomic<std::uint64_t>, static_cast<size_t>(ParseError::Count)
+        >,
+        static_cast<size_t>(Command::Count)
+    > m_errors;                             //<! Rejected lines by command
+    std::atomic<std::uint64_t> m_coalescedAnims; //<! Broadcasts merged
+    std::atomic<std::uint64_t> m_droppedAnims;   //<! Events lost on overflow
 
     bool m_hasWin;                      //<! Flag to indicate if there is a winner
-    Team m_winner;                      //<! The winning team
-    std::deque<AnimationEvent> m_anims; //<! Animation events for visualization
+    std::shared_ptr<const Team> m_winner; //<! The winning team
+    std::vector<AnimationEvent> m_pendingAnims; //<! Unpublished animation events
+    std::vector<std::uint32_t> m_broadcastSlots; //<! Merge table, 0 is free
+    SpscQueue<AnimationEvent, ANIMATION_QUEUE_SIZE> m_anims; //<! To render
 
 private:
     ///////////////////////////////////////////////////////////////////////////
@@ -231,385 +364,559 @@ public:
     void ResetChanged(void);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Lock the game state for thread safety
+    /// \brief Get the last snapshot published by the network thread
+    ///
+    /// The snapshot is immutable, so it can be read without any lock for as
+    /// long as the returned pointer is held. Later changes are published as
+    /// new snapshots and never reach this one.
+    ///
+    /// \return The last published snapshot, never null
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void Lock(void) const;
+    std::shared_ptr<const Snapshot> GetSnapshot(void) const;
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Unlock the game state after thread safety operations
+    /// \brief Get the receive throughput of the server connection
+    ///
+    /// \return The socket receive statistics
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void Unlock(void) const;
+    Socket::Statistics GetNetworkStatistics(void) const;
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Get the dimensions of the game map
+    /// \brief Get the network thread wake-up and latency counters
     ///
-    /// \return A tuple containing the width and height of the game map
+    /// The latencies and the dispatch allocation count cover the last batch
+    /// of lines read after a wake-up. The snapshot built from them is
+    /// counted apart, by the allocations of the last Publish.
+    ///
+    /// \return The ingest statistics
     ///
     ///////////////////////////////////////////////////////////////////////////
-    std::tuple<unsigned int, unsigned int> GetDimensions(void) const;
+    IngestStatistics GetIngestStatistics(void) const;
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Get the width of the game map
+    /// \brief Get the protocol name of a command
+    ///
+    /// \param command The command
     ///
-    /// \return The width of the game map
+    /// \return The three-letter name of the command
     ///
     ///////////////////////////////////////////////////////////////////////////
-    unsigned int GetWidth(void) const;
+    static const char* GetCommandName(Command command);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Get the height of the game map
+    /// \brief Get the display name of a parse error
+    ///
+    /// \param error The parse error
     ///
-    /// \return The height of the game map
+    /// \return The name of the error
     ///
     ///////////////////////////////////////////////////////////////////////////
-    unsigned int GetHeight(void) const;
+    static const char* GetErrorName(ParseError error);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Get the tile at the specified coordinates
+    /// \brief Find the command of a protocol name
     ///
-    /// \param x The x-coordinate of the tile
-    /// \param y The y-coordinate of the tile
+    /// The name is packed into an integer and matched by a switch, with no
+    /// hashing, no string and no indirect call.
+    ///
+    /// \param name The three-letter command name
     ///
-    /// \return A reference to the Inventory object at the specified tile
+    /// \return The command, or Command::Count if the name is unknown
     ///
     ///////////////////////////////////////////////////////////////////////////
-    const Inventory& GetTileAt(unsigned int x, unsigned int y) const;
+    static Command FindCommand(std::string_view name);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Get all tiles in the game state
+    /// \brief Check if the game state has changed
     ///
-    /// \return A vector containing all Inventory objects representing the
-    /// tiles
+    /// \return True if the game state has changed, false otherwise
     ///
     ///////////////////////////////////////////////////////////////////////////
-    const std::vector<Inventory>& GetTiles(void) const;
+    bool HasChanged(void) const;
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Get all teams in the game state
+    /// \brief Check if the game state has changed and reset the flag
     ///
-    /// \return A vector containing all Team objects
+    /// Checking and resetting happen atomically, so a change made by the
+    /// network thread in between cannot be lost.
+    ///
+    /// \return True if the game state has changed since the last call
     ///
     ///////////////////////////////////////////////////////////////////////////
-    const std::vector<Team>& GetTeams(void) const;
+    bool ConsumeChanged(void);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Get all messages in the game state
+    /// \brief Take the set of tiles changed since the last call
+    ///
+    /// Bit i of the set stands for the tile at (i % width, i / width). Tiles
+    /// are marked by bct updates and by players appearing, moving, turning or
+    /// leaving; msz marks every tile. Tiles are handed over once the snapshot
+    /// holding their new content is published, so calling GetSnapshot after
+    /// this method always reads them up to date. The given vector is swapped
+    /// with the internal one, so passing the same vector every time avoids
+    /// allocations.
     ///
-    /// \return A vector containing all Message objects
+    /// \param dirty Receives the set of changed tiles, in 64-bit words
     ///
     ///////////////////////////////////////////////////////////////////////////
-    const std::deque<Message>& GetMessages(void) const;
+    void ConsumeDirtyTiles(std::vector<std::uint64_t>& dirty);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Get the total resources in the game state
+    /// \brief Takes the oldest published animation event
+    ///
+    /// Only the render thread may call this; it never blocks the network
+    /// thread.
     ///
-    /// \return A reference to the Inventory object representing the total
+    /// \return The event, std::nullopt if none is waiting
     ///
     ///////////////////////////////////////////////////////////////////////////
-    const Inventory& GetTotalResources(void);
+    std::optional<AnimationEvent> PopAnimation(void);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Get the frequency of the game updates
+    /// \brief Discards every published animation event
     ///
-    /// \return The frequency of the game updates
+    /// Only the render thread may call this.
     ///
     ///////////////////////////////////////////////////////////////////////////
-    unsigned int GetFrequency(void) const;
+    void ClearAnimationEvents(void);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Get the number of living players in the game state
+    /// \brief Apply protocol lines without a connection and publish them
+    ///
+    /// The lines go through the same parsers as the ones read from the
+    /// server, so recorded games can be replayed by tools and tests. The
+    /// state belongs to the network thread: only call this while it is
+    /// stopped.
     ///
-    /// \return The number of living players
+    /// \param lines Lines of the protocol, each one ending with a newline
     ///
     ///////////////////////////////////////////////////////////////////////////
-    unsigned int GetLivingPlayers(void) const;
+    void Replay(std::string_view lines);
 
+private:
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Get the number of dead players in the game state
-    ///
-    /// \return The number of dead players
+    /// \brief Network thread body, blocks in epoll until the socket is
+    /// readable or StopNetworkThread is called
     ///
     ///////////////////////////////////////////////////////////////////////////
-    unsigned int GetDeadPlayers(void) const;
+    void NetworkThreadFunction(void);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Get the player by ID
-    ///
-    /// \param x The x-coordinate of the tile
-    /// \param y The y-coordinate of the tile
-    ///
-    /// \return A vector of references to Player objects at the specified tile
+    /// \brief Process incoming network messages
     ///
     ///////////////////////////////////////////////////////////////////////////
-    std::vector<const Player*> GetPlayersAt(
-        unsigned int x, unsigned int y
-    ) const;
+    void ProcessNetworkMessages(void);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Check if the game state has changed
+    /// \brief Publish a snapshot if lines were dispatched since the last one
+    /// and PUBLISH_INTERVAL has elapsed, or retry the retained animations
     ///
-    /// \return True if the game state has changed, false otherwise
+    /// \return The epoll timeout in milliseconds until the pending snapshot
+    /// or the next retry is due, -1 if there is nothing left to publish
     ///
     ///////////////////////////////////////////////////////////////////////////
-    bool HasChanged(void) const;
+    int PublishIfDue(void);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Check if someone has won the game
+    /// \brief Publish a new snapshot of the game state
     ///
-    /// \return True if there is a winner, false otherwise
+    /// The new snapshot shares every region, team and table left untouched
+    /// since the previous one. The changed tiles and the pending animation
+    /// events are handed over to the render thread once it is visible.
     ///
     ///////////////////////////////////////////////////////////////////////////
-    bool HasWin(void) const;
+    void Publish(void);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Get the winning team
+    /// \brief Move the pending animation events to the render queue
     ///
-    /// \return A reference to the winning Team object
+    /// Broadcasts raised on the same tile by the same team since the last
+    /// publication are merged into the first one, whose intensity counts
+    /// them. They are matched through an open addressing table of kept
+    /// positions, which only grows with the number of pending events.
+    ///
+    /// Overflow policy: when the render thread lags and the queue is full,
+    /// the remaining broadcasts are dropped, being purely cosmetic, while
+    /// the incantation events are kept and retried by PublishIfDue every
+    /// PUBLISH_INTERVAL until there is room, even if no line arrives. At
+    /// most ANIMATION_QUEUE_SIZE of them are kept, the newer ones are
+    /// dropped. Every dropped event is counted in the ingest statistics.
     ///
     ///////////////////////////////////////////////////////////////////////////
-    const Team& GetWinner(void) const;
+    void FlushAnimations(void);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Append a message to the log
     ///
-    /// \return
+    /// \param message The structured message
+    /// \param payload The free text of the message, if any
     ///
     ///////////////////////////////////////////////////////////////////////////
-    const std::deque<AnimationEvent>& GetAnimationEvents(void) const;
+    void PostMessage(const Message& message, std::string_view payload = {});
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Mark a team for copy in the next snapshot
     ///
-    /// \return
+    /// \param team The index of the team in m_teams
     ///
     ///////////////////////////////////////////////////////////////////////////
-    std::optional<AnimationEvent> PopAnimation(void);
+    void MarkTeamChanged(size_t team);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Pack a three-letter command name into an integer key
+    ///
+    /// \param name The command name
     ///
-    /// \return
+    /// \return The packed key, or 0 if the name is not three letters long
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void ClearAnimationEvents(void);
-
+    static constexpr std::uint32_t CommandKey(std::string_view name)
+    {
+        if (name.size() != 3)
+        {
+            return (0);
+        }
+        return (
+            static_cast<std::uint32_t>(static_cast<unsigned char>(name[0])) << 16 |
+            static_cast<std::uint32_t>(static_cast<unsigned char>(name[1])) << 8 |
+            static_cast<std::uint32_t>(static_cast<unsigned char>(name[2]))
+        );
+    }
 
-private:
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Process a command from the game server
+    /// \brief Call the parser of a command
+    ///
+    /// \param name The three-letter command name
+    /// \param args The command arguments
+    ///
+    /// Rejected lines are counted by command and by error.
+    ///
+    /// \return True if the command is known, false otherwise
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void NetworkThreadFunction(void);
+    bool Dispatch(std::string_view name, std::string_view args);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Process incoming network messages
+    /// \brief
+    ///
+    /// \param msg
+    ///
+    /// \return Nothing, or the reason the line was rejected
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void ProcessNetworkMessages(void);
+    ParseResult ParseMSZ(std::string_view msg);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param msg
     ///
+    /// \return Nothing, or the reason the line was rejected
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void ParseMSZ(const std::string& msg);
+    ParseResult ParseBCT(std::string_view msg);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param msg
     ///
+    /// \return Nothing, or the reason the line was rejected
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void ParseBCT(const std::string& msg);
+    ParseResult ParseTNA(std::string_view msg);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param msg
     ///
+    /// \return Nothing, or the reason the line was rejected
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void ParseTNA(const std::string& msg);
+    ParseResult ParsePNW(std::string_view msg);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param msg
     ///
+    /// \return Nothing, or the reason the line was rejected
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void ParsePNW(const std::string& msg);
+    ParseResult ParsePPO(std::string_view msg);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param msg
     ///
+    /// \return Nothing, or the reason the line was rejected
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void ParsePPO(const std::string& msg);
+    ParseResult ParsePLV(std::string_view msg);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param msg
     ///
+    /// \return Nothing, or the reason the line was rejected
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void ParsePLV(const std::string& msg);
+    ParseResult ParsePIN(std::string_view msg);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param msg
     ///
+    /// \return Nothing, or the reason the line was rejected
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void ParsePIN(const std::string& msg);
+    ParseResult ParsePEX(std::string_view msg);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param msg
     ///
+    /// \return Nothing, or the reason the line was rejected
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void ParsePEX(const std::string& msg);
+    ParseResult ParsePBC(std::string_view msg);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param msg
     ///
+    /// \return Nothing, or the reason the line was rejected
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void ParsePBC(const std::string& msg);
+    ParseResult ParsePIC(std::string_view msg);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param msg
     ///
+    /// \return Nothing, or the reason the line was rejected
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void ParsePIC(const std::string& msg);
+    ParseResult ParsePIE(std::string_view msg);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param msg
     ///
+    /// \return Nothing, or the reason the line was rejected
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void ParsePIE(const std::string& msg);
+    ParseResult ParsePFK(std::string_view msg);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param msg
     ///
+    /// \return Nothing, or the reason the line was rejected
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void ParsePFK(const std::string& msg);
+    ParseResult ParsePDR(std::string_view msg);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param msg
     ///
+    /// \return Nothing, or the reason the line was rejected
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void ParsePDR(const std::string& msg);
+    ParseResult ParsePGT(std::string_view msg);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param msg
     ///
+    /// \return Nothing, or the reason the line was rejected
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void ParsePGT(const std::string& msg);
+    ParseResult ParsePDI(std::string_view msg);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param msg
     ///
+    /// \return Nothing, or the reason the line was rejected
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void ParsePDI(const std::string& msg);
+    ParseResult ParseENW(std::string_view msg);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param msg
     ///
+    /// \return Nothing, or the reason the line was rejected
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void ParseENW(const std::string& msg);
+    ParseResult ParseEBO(std::string_view msg);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param msg
     ///
+    /// \return Nothing, or the reason the line was rejected
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void ParseEBO(const std::string& msg);
+    ParseResult ParseEDI(std::string_view msg);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param msg
     ///
+    /// \return Nothing, or the reason the line was rejected
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void ParseEDI(const std::string& msg);
+    ParseResult ParseSGT(std::string_view msg);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param msg
     ///
+    /// \return Nothing, or the reason the line was rejected
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void ParseSGT(const std::string& msg);
+    ParseResult ParseSST(std::string_view msg);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param msg
     ///
+    /// \return Nothing, or the reason the line was rejected
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void ParseSST(const std::string& msg);
+    ParseResult ParseSEG(std::string_view msg);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param msg
     ///
+    /// \return Nothing, or the reason the line was rejected
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void ParseSEG(const std::string& msg);
+    ParseResult ParseSMG(std::string_view msg);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param msg
     ///
+    /// \return Nothing, or the reason the line was rejected
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void ParseSMG(const std::string& msg);
+    ParseResult ParseSUC(std::string_view msg);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param msg
     ///
+    /// \return Nothing, or the reason the line was rejected
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void ParseSUC(const std::string& msg);
+    ParseResult ParseSBP(std::string_view msg);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Finds a living player and its team through the ID index
     ///
-    /// \param msg
+    /// Late events about dead players are common, so a missing ID is
+    /// reported as a result instead of an exception. The player is copied
+    /// first if the published snapshot still shares it, so only lookups
+    /// about to change it go through here.
+    ///
+    /// \param id The player ID
+    ///
+    /// \return The player and its team, or ParseError::UnknownPlayer
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void ParseSBP(const std::string& msg);
+    Expected<PlayerRef, ParseError> FindPlayer(unsigned int id);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Removes a player from its team and from the ID index
+    ///
+    /// The handles of the other players of the team stay valid.
+    ///
+    /// \param id The player ID
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void RemovePlayer(unsigned int id);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Moves a player to the tile bucket matching its position
+    ///
+    /// \param id The player ID
     ///
-    /// \param iss
+    ///////////////////////////////////////////////////////////////////////////
+    void UpdateOccupancy(unsigned int id);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Removes a player from its tile bucket
+    ///
+    /// \param id The player ID
+    /// \param index The player location
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void ClearOccupancy(unsigned int id, PlayerIndex& index);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets the index of the region containing a tile
+    ///
+    /// \param x The x-coordinate of the tile
+    /// \param y The y-coordinate of the tile
+    ///
+    /// \return The index of the region in m_regionResources
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t GetRegionIndex(unsigned int x, unsigned int y) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Recomputes the total and per region resources from the tiles
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void RebuildResources(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copies a region of the map for a snapshot
+    ///
+    /// \param column The column of the region
+    /// \param row The row of the region
+    ///
+    /// \return The tiles, resources and occupants of the region
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::shared_ptr<const Snapshot::Region> BuildRegion(
+        unsigned int column, unsigned int row
+    ) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Mark a tile as changed for the renderer
     ///
-    /// \return
+    /// \param tile The index of the tile, NO_TILE is ignored
     ///
     ///////////////////////////////////////////////////////////////////////////
-    Player& GetPlayerByID(std::istringstream& iss);
+    void MarkDirty(size_t tile);
 };
 
 } // !namespace Zappy
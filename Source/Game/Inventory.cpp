@@ -3,6 +3,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "Game/Inventory.hpp"
 #include "Graphics/Gui.hpp"
+#include <array>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Zappy
@@ -22,15 +23,38 @@ Inventory::Inventory(void)
 {}
 
 ///////////////////////////////////////////////////////////////////////////////
-void Inventory::ParseContent(std::istringstream& content)
+const char* Inventory::GetResourceName(unsigned int index)
 {
-    content >> food
-            >> linemate
-            >> deraumere
-            >> sibur
-            >> mendiane
-            >> phiras
-            >> thystame;
+    static const std::array<const char*, RESOURCE_COUNT> names =
+    {
+        "food",
+        "linemate", "deraumere", "sibur",
+        "mendiane", "phiras", "thystame"
+    };
+
+    return (names[index]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Inventory::ParseContent(Tokenizer& content)
+{
+    Inventory parsed;
+
+    content.ReadUnsigned(parsed.food);
+    content.ReadUnsigned(parsed.linemate);
+    content.ReadUnsigned(parsed.deraumere);
+    content.ReadUnsigned(parsed.sibur);
+    content.ReadUnsigned(parsed.mendiane);
+    content.ReadUnsigned(parsed.phiras);
+    content.ReadUnsigned(parsed.thystame);
+
+    if (content.HasFailed() || !content.AtEnd())
+    {
+        return (false);
+    }
+
+    *this = parsed;
+    return (true);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -155,4 +179,16 @@ void Inventory::Add(const Inventory& other)
     thystame += other.thystame;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void Inventory::Subtract(const Inventory& other)
+{
+    food -= other.food;
+    linemate -= other.linemate;
+    deraumere -= other.deraumere;
+    sibur -= other.sibur;
+    mendiane -= other.mendiane;
+    phiras -= other.phiras;
+    thystame -= other.thystame;
+}
+
 } // !namespace Zappy
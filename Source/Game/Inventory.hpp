@@ -6,9 +6,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
-
+#include "Network/Tokenizer.hpp"
 #include <string>
-#include <sstream>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Zappy
@@ -22,6 +21,12 @@ namespace Zappy
 ///////////////////////////////////////////////////////////////////////////////
 class Inventory
 {
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Number of resource kinds, indexed as in the server protocol
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr unsigned int RESOURCE_COUNT = 7;
+
 public:
     ///////////////////////////////////////////////////////////////////////////
     // Public members
@@ -43,12 +48,26 @@ public:
 
 public:
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Parses the content string to fill the inventory
+    /// \brief Gets the name of a resource
+    ///
+    /// \param index The protocol index of the resource, below RESOURCE_COUNT
+    ///
+    /// \return The name of the resource
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static const char* GetResourceName(unsigned int index);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Parses the seven resource quantities to fill the inventory
     ///
-    /// \param content The content string to parse
+    /// \param content The tokenizer positioned on the first quantity
+    ///
+    /// \return False if a quantity is missing or malformed or if more
+    /// fields follow, in which case the inventory is left untouched
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void ParseContent(std::istringstream& content);
+    bool ParseContent(Tokenizer& content);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Draws the inventory text
@@ -75,6 +94,14 @@ public:
     ///
     ///////////////////////////////////////////////////////////////////////////
     void Add(const Inventory& other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Subtracts the resources of another inventory from this one
+    ///
+    /// \param other The other inventory to subtract resources from
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Subtract(const Inventory& other);
 };
 
 } // !namespace Zappy
@@ -2,6 +2,8 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Game/Message.hpp"
+#include "Game/Inventory.hpp"
+#include <array>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Zappy
@@ -9,42 +11,116 @@
 namespace Zappy
 {
 
+///////////////////////////////////////////////////////////////////////////////
+// Constants
+///////////////////////////////////////////////////////////////////////////////
+namespace
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Static properties of an event
+///
+///////////////////////////////////////////////////////////////////////////////
+struct EventInfo
+{
+    Message::Type type;         //<! Category of the event
+    bool fromPlayer;            //<! The player involved sent the message
+    bool isImportant;           //<! Kept in the important messages ring
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Properties by event, in the order of Message::Event
+///////////////////////////////////////////////////////////////////////////////
+constexpr std::array<EventInfo, static_cast<size_t>(Message::Event::Count)>
+    EVENTS =
+{{
+    {Message::Type::Event, false, false},
+    {Message::Type::Broadcast, true, false},
+    {Message::Type::Incantation, false, true},
+    {Message::Type::Incantation, false, true},
+    {Message::Type::Egg, true, false},
+    {Message::Type::Resource, true, false},
+    {Message::Type::Resource, true, false},
+    {Message::Type::Death, false, false},
+    {Message::Type::Egg, true, false},
+    {Message::Type::Egg, false, false},
+    {Message::Type::Egg, false, false},
+    {Message::Type::Victory, false, true},
+    {Message::Type::Info, false, false},
+    {Message::Type::Error, false, false},
+    {Message::Type::Error, false, false}
+}};
+
+///////////////////////////////////////////////////////////////////////////////
+const EventInfo& GetEventInfo(Message::Event event)
+{
+    return (EVENTS[static_cast<size_t>(event)]);
+}
+
+} // !namespace
+
 ///////////////////////////////////////////////////////////////////////////////
 Message::Message(
-    const std::string& content,
-    const std::string& type,
-    const std::string& source,
-    bool isImportant
+    Event event,
+    unsigned int player,
+    unsigned int x,
+    unsigned int y,
+    unsigned int value
 )
-    : m_content(content)
-    , m_type(type)
-    , m_source(source)
-    , m_isImportant(isImportant)
+    : m_event(event)
+    , m_player(player)
+    , m_x(x)
+    , m_y(y)
+    , m_value(value)
+    , m_payload(nullptr)
+    , m_length(0)
     , m_timestamp(std::chrono::steady_clock::now())
 {}
 
 ///////////////////////////////////////////////////////////////////////////////
-const std::string& Message::GetContent(void) const
+const char* Message::GetTypeName(Type type)
+{
+    static const std::array<const char*, static_cast<size_t>(Type::Count)>
+        names = {
+            "Broadcast", "Egg", "Event", "Incantation", "Resource",
+            "Death", "Victory", "Info", "Error"
+        };
+
+    return (names[static_cast<size_t>(type)]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int Message::GetTypeMask(Type type)
 {
-    return m_content;
+    return (1u << static_cast<unsigned int>(type));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-const std::string& Message::GetType(void) const
+Message::Event Message::GetEvent(void) const
 {
-    return m_type;
+    return (m_event);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-const std::string& Message::GetSource(void) const
+Message::Type Message::GetType(void) const
 {
-    return m_source;
+    return (GetEventInfo(m_event).type);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string Message::GetSource(void) const
+{
+    if (!GetEventInfo(m_event).fromPlayer)
+    {
+        return ("Server");
+    }
+    return ("Player " + std::to_string(m_player));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 bool Message::IsImportant(void) const
 {
-    return (m_isImportant);
+    return (GetEventInfo(m_event).isImportant);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -53,4 +129,74 @@ Message::TimePoint Message::GetTimestamp(void) const
     return (m_timestamp);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void Message::Format(std::string_view payload, std::string& output) const
+{
+    std::string player = "Player " + std::to_string(m_player);
+    std::string position =
+        "(" + std::to_string(m_x) + ", " + std::to_string(m_y) + ")";
+
+    output.clear();
+    switch (m_event)
+    {
+        case Event::PlayerLeft:
+            output.append(player).append(" has left the game.");
+            break;
+        case Event::Broadcast:
+            output.append(player).append(": ").append(payload);
+            break;
+        case Event::IncantationStart:
+            output.append("Incantation started at ").append(position)
+                .append(" for level ").append(std::to_string(m_value))
+                .append(" by ").append(player);
+            break;
+        case Event::IncantationEnd:
+            output.append("Incantation ended at ").append(position)
+                .append(" with result: ").append(payload);
+            break;
+        case Event::EggLaying:
+            output.append(player).append(" is laying an egg");
+            break;
+        case Event::ResourceDrop:
+            output.append(player).append(" has dropped a resource: ")
+                .append(Inventory::GetResourceName(m_value));
+            break;
+        case Event::ResourceTake:
+            output.append(player).append(" has taken a resource: ")
+                .append(Inventory::GetResourceName(m_value));
+            break;
+        case Event::Death:
+            output.append(player).append(" died");
+            break;
+        case Event::EggLaid:
+            output.append("Egg ").append(std::to_string(m_value))
+                .append(" laid by ").append(player).append(" at ")
+                .append(position);
+            break;
+        case Event::EggHatched:
+            output.append("Egg ").append(std::to_string(m_value))
+                .append(" has been hatched");
+            break;
+        case Event::EggDestroyed:
+            output.append("Egg ").append(std::to_string(m_value))
+                .append(" has been destroyed");
+            break;
+        case Event::Victory:
+            output.append("Team ").append(payload)
+                .append(" has won the game!");
+            break;
+        case Event::ServerMessage:
+            output.append(payload);
+            break;
+        case Event::UnknownCommand:
+            output.append("Unknown command: ").append(payload);
+            break;
+        case Event::BadParameter:
+            output.append("Bad parameter for command: ").append(payload);
+            break;
+        default:
+            break;
+    }
+}
+
 } // !namespace Zappy
@@ -7,7 +7,9 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include <string>
+#include <string_view>
 #include <chrono>
+#include <cstdint>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Zappy
@@ -16,11 +18,60 @@ namespace Zappy
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief
+/// \brief Entry of the game log
+///
+/// A message only records the fields of the event it describes. Its text is
+/// built on demand, once the row is displayed; free text such as a broadcast
+/// is kept by the MessageLog alongside the message.
 ///
 ///////////////////////////////////////////////////////////////////////////////
 class Message
 {
+    friend class MessageLog;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Category of a message, used to filter the log
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    enum class Type : std::uint8_t
+    {
+        Broadcast,
+        Egg,
+        Event,
+        Incantation,
+        Resource,
+        Death,
+        Victory,
+        Info,
+        Error,
+        Count
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Event described by a message, selecting its text
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    enum class Event : std::uint8_t
+    {
+        PlayerLeft,                     //<! player
+        Broadcast,                      //<! player, payload
+        IncantationStart,               //<! player, x, y, value = level
+        IncantationEnd,                 //<! x, y, payload = result
+        EggLaying,                      //<! player
+        ResourceDrop,                   //<! player, value = resource
+        ResourceTake,                   //<! player, value = resource
+        Death,                          //<! player
+        EggLaid,                        //<! player, x, y, value = egg
+        EggHatched,                     //<! value = egg
+        EggDestroyed,                   //<! value = egg
+        Victory,                        //<! payload = team name
+        ServerMessage,                  //<! payload
+        UnknownCommand,                 //<! payload
+        BadParameter,                   //<! payload = command and parameters
+        Count
+    };
+
 private:
     ///////////////////////////////////////////////////////////////////////////
     // Type alias for time point
@@ -31,37 +82,72 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     // Private members
     ///////////////////////////////////////////////////////////////////////////
-    std::string m_content;      //<! The content of the message
-    std::string m_type;         //<! The type of the message
-    std::string m_source;       //<! The source of the message
-    bool m_isImportant;         //<! Indicate if the message is important
+    Event m_event;              //<! The event described by the message
+    std::uint32_t m_player;     //<! ID of the player involved
+    std::uint32_t m_x;          //<! X coordinate of the event
+    std::uint32_t m_y;          //<! Y coordinate of the event
+    std::uint32_t m_value;      //<! Level, resource index or egg ID
+    const char* m_payload;      //<! Free text, owned by the MessageLog
+    std::uint32_t m_length;     //<! Length of the free text
     TimePoint m_timestamp;      //<! The timestamp of the message
 
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor of an empty slot of the MessageLog
+    ///
+    /// The slot is overwritten before the log counts it as a message.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Message(void) = default;
+
 public:
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Constructor of a message stamped with the current time
     ///
-    /// \param content The content of the message
-    /// \param type The type of the message
-    /// \param source The source of the message
-    /// \param isImportant Indicate if the message is important
+    /// \param event The event described by the message
+    /// \param player The ID of the player involved, if any
+    /// \param x The x-coordinate of the event, if any
+    /// \param y The y-coordinate of the event, if any
+    /// \param value The level, resource index or egg ID, if any
     ///
     ///////////////////////////////////////////////////////////////////////////
     Message(
-        const std::string& content,
-        const std::string& type,
-        const std::string& source,
-        bool isImportant = false
+        Event event,
+        unsigned int player = 0,
+        unsigned int x = 0,
+        unsigned int y = 0,
+        unsigned int value = 0
     );
 
 public:
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Get the content of the message
+    /// \brief Get the display name of a message type
+    ///
+    /// \param type The message type
+    ///
+    /// \return The name of the type
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static const char* GetTypeName(Type type);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the filter bit of a message type
+    ///
+    /// \param type The message type
+    ///
+    /// \return A mask with only the bit of the type set
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static unsigned int GetTypeMask(Type type);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the event described by the message
     ///
-    /// \return The content of the message
+    /// \return The event of the message
     ///
     ///////////////////////////////////////////////////////////////////////////
-    const std::string& GetContent(void) const;
+    Event GetEvent(void) const;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Get the type of the message
@@ -69,18 +155,18 @@ public:
     /// \return The type of the message
     ///
     ///////////////////////////////////////////////////////////////////////////
-    const std::string& GetType(void) const;
+    Type GetType(void) const;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Get the source of the message
     ///
-    /// \return The source of the message
+    /// \return The name of the player who sent it, or "Server"
     ///
     ///////////////////////////////////////////////////////////////////////////
-    const std::string& GetSource(void) const;
+    std::string GetSource(void) const;
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Get the source of the message
+    /// \brief Check if the message is important
     ///
     /// \return True if the message is important, false otherwise
     ///
@@ -94,6 +180,15 @@ public:
     ///
     ///////////////////////////////////////////////////////////////////////////
     TimePoint GetTimestamp(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Build the text of the message
+    ///
+    /// \param payload The free text of the message, as stored in the log
+    /// \param output The string receiving the text, cleared first
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Format(std::string_view payload, std::string& output) const;
 };
 
 } // !namespace Zappy
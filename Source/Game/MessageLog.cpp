@@ -0,0 +1,114 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Game/MessageLog.hpp"
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+namespace Zappy
+{
+
+///////////////////////////////////////////////////////////////////////////////
+MessageLog::Lane::Lane(size_t maxCount)
+    : segments((maxCount + SEGMENT_SIZE - 1) / SEGMENT_SIZE + 1)
+    , count(0)
+    , capacity(maxCount)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+MessageLog::MessageLog(void)
+    : m_regular(CAPACITY)
+    , m_important(IMPORTANT_CAPACITY)
+    , m_sequence(0)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+void MessageLog::Push(Message message, std::string_view payload)
+{
+    Lane& lane = message.IsImportant() ? m_important : m_regular;
+
+    // The first message of a segment evicts the oldest one
+    if (lane.count % SEGMENT_SIZE == 0)
+    {
+        auto segment = std::make_shared<Segment>();
+
+        segment->cursor = nullptr;
+        segment->available = 0;
+        lane.segments.Push(std::move(segment));
+    }
+
+    Segment& segment = *lane.segments[lane.segments.GetSize() - 1];
+
+    message.m_payload = StoreText(segment, payload);
+    message.m_length = static_cast<std::uint32_t>(payload.size());
+
+    // A shared log only reads the slots below its own count, so filling the
+    // next one before counting it never touches what the copy reads
+    segment.entries[lane.count % SEGMENT_SIZE] = Entry{
+        m_sequence++, std::move(message)
+    };
+    lane.count++;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string_view MessageLog::GetPayload(const Message& message) const
+{
+    return (std::string_view(message.m_payload, message.m_length));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void MessageLog::Format(const Message& message, std::string& output) const
+{
+    message.Format(GetPayload(message), output);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t MessageLog::GetSize(void) const
+{
+    return (GetLaneSize(m_regular) + GetLaneSize(m_important));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::shared_ptr<const MessageLog> MessageLog::Share(void) const
+{
+    return (std::shared_ptr<const MessageLog>(new MessageLog(*this)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const char* MessageLog::StoreText(Segment& segment, std::string_view payload)
+{
+    if (payload.empty())
+    {
+        return (nullptr);
+    }
+
+    if (payload.size() > segment.available)
+    {
+        size_t size = std::max(payload.size(), TEXT_BLOCK_SIZE);
+
+        segment.text.emplace_back(new char[size]);
+        segment.cursor = segment.text.back().get();
+        segment.available = size;
+    }
+
+    char* text = segment.cursor;
+
+    std::memcpy(text, payload.data(), payload.size());
+    segment.cursor += payload.size();
+    segment.available -= payload.size();
+    return (text);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t MessageLog::GetLaneSize(const Lane& lane)
+{
+    return (static_cast<size_t>(
+        std::min<std::uint64_t>(lane.count, lane.capacity)
+    ));
+}
+
+} // !namespace Zappy
@@ -0,0 +1,243 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Game/Message.hpp"
+#include "Utils/RingBuffer.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <array>
+#include <memory>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+namespace Zappy
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Bounded log of the game messages
+///
+/// Regular and important messages are kept in two separate lanes, so a
+/// flood of broadcasts cannot push out an incantation or a victory.
+///
+/// A lane is a ring of segments of SEGMENT_SIZE messages, each owning the
+/// free text of its messages. Messages are only ever appended past the end
+/// of the newest segment and never rewritten, so a shared log copies the
+/// segment pointers and keeps reading its own messages while the original
+/// goes on appending. Once full, a lane evicts its oldest segment along
+/// with its text.
+///
+///////////////////////////////////////////////////////////////////////////////
+class MessageLog
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Number of regular messages kept
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t CAPACITY = 200;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Number of important messages kept
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t IMPORTANT_CAPACITY = 100;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Number of messages in a segment
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t SEGMENT_SIZE = 32;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Size in bytes of the blocks receiving the free text of a segment
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t TEXT_BLOCK_SIZE = 1024;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Message tagged with its position in the log
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        std::uint64_t sequence;         //<! Number of messages posted before
+        Message message;                //<! The message
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Messages appended together, with their free text
+    ///
+    /// Entries are fixed slots and text blocks never move, so appending
+    /// never touches the slots or the text a shared log can read.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Segment
+    {
+        std::array<Entry, SEGMENT_SIZE> entries; //<! Messages, in order
+        std::vector<std::unique_ptr<char[]>> text; //<! Blocks of free text
+        char* cursor;                   //<! Free space of the last block
+        size_t available;               //<! Bytes left after the cursor
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Ring of segments holding the messages of one importance
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Lane
+    {
+        RingBuffer<std::shared_ptr<Segment>> segments; //<! Oldest first
+        std::uint64_t count;            //<! Messages appended to the lane
+        size_t capacity;                //<! Messages kept
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Constructor of an empty lane
+        ///
+        /// One segment more than the capacity needs is kept, so the lane
+        /// still holds the capacity right after evicting the oldest one.
+        ///
+        /// \param maxCount The number of messages kept
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        explicit Lane(size_t maxCount);
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private members
+    ///////////////////////////////////////////////////////////////////////////
+    Lane m_regular;                     //<! Regular messages
+    Lane m_important;                   //<! Important messages
+    std::uint64_t m_sequence;           //<! Number of messages posted
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor of an empty log
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    MessageLog(void);
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy constructor sharing the segments
+    ///
+    /// Only the original may append to the segments afterwards, so copies
+    /// are only handed out read-only, through Share.
+    ///
+    /// \param other The log to share
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    MessageLog(const MessageLog& other) = default;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Appends a message to the ring matching its importance
+    ///
+    /// \param message The message to append
+    /// \param payload The free text of the message, if any
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Push(Message message, std::string_view payload = {});
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets the free text of a message
+    ///
+    /// \param message A message of this log
+    ///
+    /// \return A view of the text, valid as long as the log
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::string_view GetPayload(const Message& message) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Builds the text of a message
+    ///
+    /// \param message A message of this log
+    /// \param output The string receiving the text, cleared first
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Format(const Message& message, std::string& output) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets the number of messages kept
+    ///
+    /// \return The number of regular and important messages
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t GetSize(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Calls a function for every message, oldest first
+    ///
+    /// \tparam Function Callable taking a const Message&
+    ///
+    /// \param function The function to call
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Function>
+    void ForEach(Function&& function) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Calls a function for every message, newest first
+    ///
+    /// \tparam Function Callable taking a const Message&
+    ///
+    /// \param function The function to call
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Function>
+    void ForEachNewest(Function&& function) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Shares the messages posted so far
+    ///
+    /// \return A read-only log holding the current messages, unaffected by
+    /// the later pushes
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::shared_ptr<const MessageLog> Share(void) const;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copies the free text of a message into a segment
+    ///
+    /// \param segment The segment receiving the message
+    /// \param payload The free text of the message
+    ///
+    /// \return A pointer to the copied text
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static const char* StoreText(Segment& segment, std::string_view payload);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets the number of messages kept by a lane
+    ///
+    /// \param lane The lane
+    ///
+    /// \return The number of messages
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static size_t GetLaneSize(const Lane& lane);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets a message of a lane by age
+    ///
+    /// \param lane The lane
+    /// \param index The index of the message, 0 being the oldest kept
+    ///
+    /// \return A reference to the message and its sequence number
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static const Entry& GetEntry(const Lane& lane, size_t index);
+};
+
+} // !namespace Zappy
+
+///////////////////////////////////////////////////////////////////////////////
+// Template implementations
+///////////////////////////////////////////////////////////////////////////////
+#include "Game/MessageLog.inl"
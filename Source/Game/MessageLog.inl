@@ -0,0 +1,86 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Game/MessageLog.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+namespace Zappy
+{
+
+///////////////////////////////////////////////////////////////////////////////
+inline const MessageLog::Entry& MessageLog::GetEntry(
+    const Lane& lane,
+    size_t index
+)
+{
+    // The entries this log counts, the newest segment may hold later ones
+    size_t newest = static_cast<size_t>((lane.count - 1) % SEGMENT_SIZE) + 1;
+    size_t held = (lane.segments.GetSize() - 1) * SEGMENT_SIZE + newest;
+    size_t position = held - GetLaneSize(lane) + index;
+
+    return (
+        lane.segments[position / SEGMENT_SIZE]->entries[position % SEGMENT_SIZE]
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Function>
+void MessageLog::ForEach(Function&& function) const
+{
+    size_t regular = GetLaneSize(m_regular);
+    size_t important = GetLaneSize(m_important);
+    size_t r = 0;
+    size_t i = 0;
+
+    // Both lanes are sorted by sequence, merge them
+    while (r < regular || i < important)
+    {
+        if (
+            i == important ||
+            (r < regular &&
+                GetEntry(m_regular, r).sequence <
+                GetEntry(m_important, i).sequence)
+        )
+        {
+            function(GetEntry(m_regular, r++).message);
+        }
+        else
+        {
+            function(GetEntry(m_important, i++).message);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Function>
+void MessageLog::ForEachNewest(Function&& function) const
+{
+    size_t r = GetLaneSize(m_regular);
+    size_t i = GetLaneSize(m_important);
+
+    while (r > 0 || i > 0)
+    {
+        if (
+            i == 0 ||
+            (r > 0 &&
+                GetEntry(m_regular, r - 1).sequence >
+                GetEntry(m_important, i - 1).sequence)
+        )
+        {
+            function(GetEntry(m_regular, --r).message);
+        }
+        else
+        {
+            function(GetEntry(m_important, --i).message);
+        }
+    }
+}
+
+} // !namespace Zappy
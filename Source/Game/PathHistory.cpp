@@ -0,0 +1,159 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Game/PathHistory.hpp"
+#include <algorithm>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+namespace Zappy
+{
+
+///////////////////////////////////////////////////////////////////////////////
+size_t PathHistory::m_defaultCapacity = PathHistory::DEFAULT_CAPACITY;
+
+///////////////////////////////////////////////////////////////////////////////
+PathHistory::PathHistory(void)
+    : m_head(0)
+    , m_count(0)
+    , m_open{0, 0, {}}
+    , m_last(0)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+void PathHistory::SetDefaultCapacity(size_t capacity)
+{
+    m_defaultCapacity = std::max<size_t>(capacity, 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t PathHistory::GetDefaultCapacity(void)
+{
+    return (m_defaultCapacity);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void PathHistory::Push(unsigned int x, unsigned int y)
+{
+    std::uint32_t packed = ((x & 0xFFFF) << 16) | (y & 0xFFFF);
+
+    if (m_ring.empty())
+    {
+        m_ring.resize(m_defaultCapacity);
+    }
+
+    if (m_count == m_ring.size())
+    {
+        Compress(m_ring[m_head]);
+        m_ring[m_head] = packed;
+        m_head = (m_head + 1) % m_ring.size();
+        return;
+    }
+    m_ring[(m_head + m_count) % m_ring.size()] = packed;
+    m_count++;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t PathHistory::GetSize(void) const
+{
+    size_t size = m_count + m_open.count;
+
+    for (const auto& block : m_sealed)
+    {
+        size += block->count;
+    }
+    return (size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t PathHistory::GetRecentCount(void) const
+{
+    return (m_count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t PathHistory::GetCompressedSize(void) const
+{
+    size_t size = m_open.data.size();
+
+    for (const auto& block : m_sealed)
+    {
+        size += block->data.size();
+    }
+    return (size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void PathHistory::Compress(std::uint32_t packed)
+{
+    if (m_open.count == 0)
+    {
+        m_open.origin = packed;
+        m_open.count = 1;
+        m_last = packed;
+        return;
+    }
+
+    int dx = static_cast<int>(packed >> 16) - static_cast<int>(m_last >> 16);
+    int dy = static_cast<int>(packed & 0xFFFF) -
+        static_cast<int>(m_last & 0xFFFF);
+    unsigned int zx = (static_cast<unsigned int>(dx) << 1) ^ (dx >> 31);
+    unsigned int zy = (static_cast<unsigned int>(dy) << 1) ^ (dy >> 31);
+
+    // Steps between neighbouring tiles fit in one byte, the rest is escaped
+    if (zx < 8 && zy < 8)
+    {
+        m_open.data.push_back(static_cast<std::uint8_t>((zx << 3) | zy));
+    }
+    else
+    {
+        m_open.data.push_back(0x80);
+        WriteVarint(m_open.data, dx);
+        WriteVarint(m_open.data, dy);
+    }
+    m_open.count++;
+    m_last = packed;
+
+    if (m_open.data.size() >= BLOCK_SIZE)
+    {
+        m_sealed.push_back(std::make_shared<const Block>(std::move(m_open)));
+        m_open = Block{0, 0, {}};
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int PathHistory::ReadVarint(
+    const std::vector<std::uint8_t>& data,
+    size_t& offset
+)
+{
+    unsigned int value = 0;
+    unsigned int shift = 0;
+    std::uint8_t byte;
+
+    do
+    {
+        byte = data[offset++];
+        value |= static_cast<unsigned int>(byte & 0x7F) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+
+    return (static_cast<int>(value >> 1) ^ -static_cast<int>(value & 1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void PathHistory::WriteVarint(std::vector<std::uint8_t>& data, int value)
+{
+    unsigned int zigzag = (static_cast<unsigned int>(value) << 1) ^
+        static_cast<unsigned int>(value >> 31);
+
+    while (zigzag >= 0x80)
+    {
+        data.push_back(static_cast<std::uint8_t>(zigzag | 0x80));
+        zigzag >>= 7;
+    }
+    data.push_back(static_cast<std::uint8_t>(zigzag));
+}
+
+} // !namespace Zappy
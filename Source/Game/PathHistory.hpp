@@ -0,0 +1,206 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+namespace Zappy
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Bounded history of the tiles a player walked through
+///
+/// The most recent positions are kept in a fixed-capacity ring of packed
+/// 16-bit coordinates. Positions pushed out of the ring are delta-encoded
+/// into blocks of bytes; full blocks are immutable and shared between the
+/// copies of a history, so copying a player only copies the ring and the
+/// block being filled.
+///
+/// A step between neighbouring tiles is encoded in a single byte. Larger
+/// jumps, such as wrapping around the map, take a marker byte followed by
+/// two zigzag varints.
+///
+///////////////////////////////////////////////////////////////////////////////
+class PathHistory
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Number of recent positions kept uncompressed by default
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t DEFAULT_CAPACITY = 64;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Size in bytes above which the block being filled is sealed
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t BLOCK_SIZE = 256;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Run of compressed positions
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Block
+    {
+        std::uint32_t origin;           //<! First packed position of the run
+        std::uint32_t count;            //<! Number of positions, with origin
+        std::vector<std::uint8_t> data; //<! Steps following the origin
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private members
+    ///////////////////////////////////////////////////////////////////////////
+    static size_t m_defaultCapacity;    //<! Capacity of new histories
+    std::vector<std::uint32_t> m_ring;  //<! Recent packed positions
+    size_t m_head;                      //<! Index of the oldest position
+    size_t m_count;                     //<! Number of positions in the ring
+    std::vector<std::shared_ptr<const Block>> m_sealed; //<! Full blocks
+    Block m_open;                       //<! Block being filled
+    std::uint32_t m_last;               //<! Last compressed position
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor of an empty history
+    ///
+    /// The ring is allocated on the first push, with the default capacity.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    PathHistory(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Sets the capacity of the histories created afterwards
+    ///
+    /// \param capacity The number of recent positions, at least 1
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void SetDefaultCapacity(size_t capacity);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets the capacity of the histories created afterwards
+    ///
+    /// \return The number of recent positions
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static size_t GetDefaultCapacity(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Appends a position to the history
+    ///
+    /// Coordinates are stored on 16 bits each.
+    ///
+    /// \param x The x-coordinate of the position
+    /// \param y The y-coordinate of the position
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Push(unsigned int x, unsigned int y);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets the total number of positions
+    ///
+    /// \return The number of recent and compressed positions
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t GetSize(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets the number of recent positions
+    ///
+    /// \return The number of positions held uncompressed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t GetRecentCount(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets the memory used by the compressed positions
+    ///
+    /// \return The size in bytes of the encoded steps
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t GetCompressedSize(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Calls a function for every recent position, oldest first
+    ///
+    /// \tparam Function Callable taking the x and y coordinates
+    ///
+    /// \param function The function to call
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Function>
+    void ForEachRecent(Function&& function) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Calls a function for every position, oldest first
+    ///
+    /// Compressed positions are decoded on the fly.
+    ///
+    /// \tparam Function Callable taking the x and y coordinates
+    ///
+    /// \param function The function to call
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Function>
+    void ForEach(Function&& function) const;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Moves a position pushed out of the ring to the compressed store
+    ///
+    /// \param packed The packed position
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Compress(std::uint32_t packed);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Decodes the positions of a block
+    ///
+    /// \tparam Function Callable taking the x and y coordinates
+    ///
+    /// \param block The block to decode
+    /// \param function The function to call for every position
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Function>
+    static void Decode(const Block& block, Function&& function);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Reads a zigzag varint
+    ///
+    /// \param data The encoded bytes
+    /// \param offset The read offset, moved past the varint
+    ///
+    /// \return The decoded value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static int ReadVarint(
+        const std::vector<std::uint8_t>& data, size_t& offset
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Appends a zigzag varint
+    ///
+    /// \param data The encoded bytes
+    /// \param value The value to encode
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void WriteVarint(std::vector<std::uint8_t>& data, int value);
+};
+
+} // !namespace Zappy
+
+///////////////////////////////////////////////////////////////////////////////
+// Template implementations
+///////////////////////////////////////////////////////////////////////////////
+#include "Game/PathHistory.inl"
@@ -0,0 +1,79 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Game/PathHistory.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+namespace Zappy
+{
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Function>
+void PathHistory::ForEachRecent(Function&& function) const
+{
+    for (size_t i = 0; i < m_count; ++i)
+    {
+        std::uint32_t packed = m_ring[(m_head + i) % m_ring.size()];
+
+        function(
+            static_cast<unsigned int>(packed >> 16),
+            static_cast<unsigned int>(packed & 0xFFFF)
+        );
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Function>
+void PathHistory::ForEach(Function&& function) const
+{
+    for (const auto& block : m_sealed)
+    {
+        Decode(*block, function);
+    }
+    Decode(m_open, function);
+    ForEachRecent(function);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Function>
+void PathHistory::Decode(const Block& block, Function&& function)
+{
+    if (block.count == 0)
+    {
+        return;
+    }
+
+    int x = static_cast<int>(block.origin >> 16);
+    int y = static_cast<int>(block.origin & 0xFFFF);
+    size_t offset = 0;
+
+    function(static_cast<unsigned int>(x), static_cast<unsigned int>(y));
+    for (std::uint32_t i = 1; i < block.count; ++i)
+    {
+        std::uint8_t step = block.data[offset++];
+
+        if (step & 0x80)
+        {
+            x += ReadVarint(block.data, offset);
+            y += ReadVarint(block.data, offset);
+        }
+        else
+        {
+            unsigned int dx = step >> 3;
+            unsigned int dy = step & 0x7;
+
+            x += static_cast<int>(dx >> 1) ^ -static_cast<int>(dx & 1);
+            y += static_cast<int>(dy >> 1) ^ -static_cast<int>(dy & 1);
+        }
+        function(static_cast<unsigned int>(x), static_cast<unsigned int>(y));
+    }
+}
+
+} // !namespace Zappy
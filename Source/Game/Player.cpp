@@ -2,8 +2,6 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Game/Player.hpp"
-#include <sstream>
-#include <iostream>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Zappy
@@ -12,24 +10,23 @@ namespace Zappy
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-Player::Player(const std::string& pnw)
-    : m_id(0)
-    , m_x(0)
-    , m_y(0)
-    , m_level(1)
+Player::Player(
+    unsigned int id,
+    unsigned int x,
+    unsigned int y,
+    unsigned int orientation,
+    unsigned int level,
+    TeamID team
+)
+    : m_id(id)
+    , m_name("Player " + std::to_string(id))
+    , m_x(x)
+    , m_y(y)
+    , m_level(level)
+    , m_orientation(orientation)
     , m_isAlive(true)
+    , m_team(team)
 {
-    std::istringstream iss(pnw);
-    std::string name;
-
-    iss >> name >> m_x >> m_y >> m_orientation >> m_level >> m_team;
-
-    if (!name.empty())
-    {
-        m_id = std::stoi(name.substr(1));
-        m_name = "Player " + std::to_string(m_id);
-    }
-
     m_inventory.food = 10;
 }
 
@@ -82,7 +79,7 @@ bool Player::IsAlive(void) const
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-const std::string& Player::GetTeam(void) const
+Player::TeamID Player::GetTeam(void) const
 {
     return (m_team);
 }
@@ -94,35 +91,56 @@ const Inventory& Player::GetInventory(void) const
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-const std::vector<Player::Coordinates>& Player::GetPath(void) const
+bool Player::UpdateInventory(Tokenizer& pin)
 {
-    return (m_path);
-}
+    unsigned int x, y;
 
-///////////////////////////////////////////////////////////////////////////////
-void Player::UpdateInventory(std::istringstream& pin)
-{
-    m_inventory.ParseContent(pin);
+    // The position sent along the inventory is already tracked through PPO
+    return (
+        pin.ReadUnsigned(x) &&
+        pin.ReadUnsigned(y) &&
+        m_inventory.ParseContent(pin)
+    );
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Player::UpdatePosition(std::istringstream& ppo)
+bool Player::UpdatePosition(Tokenizer& ppo)
 {
-    unsigned int oldX = m_x;
-    unsigned int oldY = m_y;
+    unsigned int x, y, orientation;
 
-    ppo >> m_x >> m_y >> m_orientation;
+    ppo.ReadUnsigned(x);
+    ppo.ReadUnsigned(y);
+    ppo.ReadUnsigned(orientation);
 
-    if (oldX != m_x || oldY != m_y)
+    if (
+        ppo.HasFailed() || !ppo.AtEnd() ||
+        orientation < 1 || orientation > ORIENTATION_COUNT
+    )
     {
-        m_path.emplace_back(oldX, oldY);
+        return (false);
     }
+
+    m_x = x;
+    m_y = y;
+    m_orientation = orientation;
+    return (true);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Player::UpdateLevel(std::istringstream& plv)
+bool Player::UpdateLevel(Tokenizer& plv)
 {
-    plv >> m_level;
+    unsigned int level;
+
+    if (
+        !plv.ReadUnsigned(level) || !plv.AtEnd() ||
+        level < 1 || level > MAX_LEVEL
+    )
+    {
+        return (false);
+    }
+
+    m_level = level;
+    return (true);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
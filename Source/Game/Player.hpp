@@ -7,10 +7,10 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Game/Inventory.hpp"
+#include "Network/Tokenizer.hpp"
 #include <string>
 #include <tuple>
-#include <sstream>
-#include <vector>
+#include <cstdint>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Zappy
@@ -29,6 +29,18 @@ public:
     // Type definitions
     ///////////////////////////////////////////////////////////////////////////
     using Coordinates = std::tuple<unsigned int, unsigned int>;
+    using TeamID = std::uint16_t;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Highest level a player can reach, levels start at 1
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr unsigned int MAX_LEVEL = 8;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Number of orientations, from 1 (north) to 4 (west)
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr unsigned int ORIENTATION_COUNT = 4;
 
 private:
     ///////////////////////////////////////////////////////////////////////////
@@ -42,17 +54,28 @@ private:
     unsigned int m_orientation;         //<! Player orientation
     Inventory m_inventory;              //<! Player inventory
     bool m_isAlive;                     //<! Player alive status
-    std::string m_team;                 //<! Player team name
-    std::vector<Coordinates> m_path;    //<! Player path
+    TeamID m_team;                      //<! Player team ID
 
 public:
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Default constructor
+    /// \brief Constructor from the fields of a PNW message
     ///
-    /// \param pnw The player network message string
+    /// \param id The player ID
+    /// \param x The player X coordinate
+    /// \param y The player Y coordinate
+    /// \param orientation The player orientation
+    /// \param level The player level
+    /// \param team The ID of the player team
     ///
     ///////////////////////////////////////////////////////////////////////////
-    Player(const std::string& pnw);
+    Player(
+        unsigned int id,
+        unsigned int x,
+        unsigned int y,
+        unsigned int orientation,
+        unsigned int level,
+        TeamID team
+    );
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -120,12 +143,14 @@ public:
     bool IsAlive(void) const;
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Gets the player's team name
+    /// \brief Gets the player's team ID
+    ///
+    /// The ID is the index of the team in the order teams were announced.
     ///
-    /// \return The player's team name
+    /// \return The player's team ID
     ///
     ///////////////////////////////////////////////////////////////////////////
-    const std::string& GetTeam(void) const;
+    TeamID GetTeam(void) const;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Gets the player's inventory
@@ -135,37 +160,38 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     const Inventory& GetInventory(void) const;
 
-    ///////////////////////////////////////////////////////////////////////////
-    /// \brief Gets the player's path
-    ///
-    /// \return A vector of coordinates representing the player's path
-    ///
-    ///////////////////////////////////////////////////////////////////////////
-    const std::vector<Coordinates>& GetPath(void) const;
-
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Updates the player's inventory based on the provided PIN message
     ///
-    /// \param pin The PIN message string containing inventory data
+    /// \param pin The PIN message fields following the player ID
+    ///
+    /// \return False if the fields are malformed or followed by others, in
+    /// which case the inventory is left untouched
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void UpdateInventory(std::istringstream& pin);
+    bool UpdateInventory(Tokenizer& pin);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Updates the player's position based on the provided PPO message
     ///
-    /// \param ppo The player position update string
+    /// \param ppo The PPO message fields following the player ID
+    ///
+    /// \return False if the fields are malformed or followed by others, in
+    /// which case the position is left untouched
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void UpdatePosition(std::istringstream& ppo);
+    bool UpdatePosition(Tokenizer& ppo);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Updates the player's level based on the provided PLV message
     ///
-    /// \param plv The player level update string
+    /// \param plv The PLV message fields following the player ID
+    ///
+    /// \return False if the level is malformed or followed by other fields,
+    /// in which case the level is left untouched
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void UpdateLevel(std::istringstream& plv);
+    bool UpdateLevel(Tokenizer& plv);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Sets the player's alive status
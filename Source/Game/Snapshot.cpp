@@ -0,0 +1,144 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Game/Snapshot.hpp"
+#include "Errors/Exception.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+namespace Zappy
+{
+
+///////////////////////////////////////////////////////////////////////////////
+Snapshot::Snapshot(void)
+    : m_version(0)
+    , m_width(0)
+    , m_height(0)
+    , m_frequency(0)
+    , m_livingPlayers(0)
+    , m_deadPlayers(0)
+    , m_players(std::make_shared<const PlayerTable>())
+    , m_messages(std::make_shared<const MessageLog>())
+    , m_hasWin(false)
+    , m_winner(std::make_shared<const Team>("No Winner", sf::Color::White))
+{
+    m_totalResources.Reset();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t Snapshot::GetVersion(void) const
+{
+    return (m_version);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::tuple<unsigned int, unsigned int> Snapshot::GetDimensions(void) const
+{
+    return (std::make_tuple(m_width, m_height));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int Snapshot::GetWidth(void) const
+{
+    return (m_width);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int Snapshot::GetHeight(void) const
+{
+    return (m_height);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const Inventory& Snapshot::GetTileAt(unsigned int x, unsigned int y) const
+{
+    if (x >= m_width || y >= m_height)
+    {
+        throw Exception("Invalid tile coordinates");
+    }
+    return (m_regions[GetRegionIndex(x, y)]->tiles[GetLocalIndex(x, y)]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t Snapshot::GetTeamCount(void) const
+{
+    return (m_teams.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const Team& Snapshot::GetTeam(size_t index) const
+{
+    return (*m_teams[index]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const MessageLog& Snapshot::GetMessages(void) const
+{
+    return (*m_messages);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const Inventory& Snapshot::GetTotalResources(void) const
+{
+    return (m_totalResources);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const Inventory& Snapshot::GetRegionResources(
+    unsigned int x,
+    unsigned int y
+) const
+{
+    if (x >= m_width || y >= m_height)
+    {
+        throw Exception("Invalid tile coordinates");
+    }
+    return (m_regions[GetRegionIndex(x, y)]->resources);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int Snapshot::GetFrequency(void) const
+{
+    return (m_frequency);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int Snapshot::GetLivingPlayers(void) const
+{
+    return (m_livingPlayers);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int Snapshot::GetDeadPlayers(void) const
+{
+    return (m_deadPlayers);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Snapshot::HasWin(void) const
+{
+    return (m_hasWin);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const Team& Snapshot::GetWinner(void) const
+{
+    return (*m_winner);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t Snapshot::GetRegionIndex(unsigned int x, unsigned int y) const
+{
+    unsigned int columns = (m_width + REGION_SIZE - 1) / REGION_SIZE;
+
+    return (static_cast<size_t>(y / REGION_SIZE) * columns + x / REGION_SIZE);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t Snapshot::GetLocalIndex(unsigned int x, unsigned int y)
+{
+    return (static_cast<size_t>(y % REGION_SIZE) * REGION_SIZE + x % REGION_SIZE);
+}
+
+} // !namespace Zappy
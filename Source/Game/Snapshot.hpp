@@ -0,0 +1,305 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Game/Inventory.hpp"
+#include "Game/Team.hpp"
+#include "Game/MessageLog.hpp"
+#include <vector>
+#include <tuple>
+#include <memory>
+#include <cstdint>
+#include <unordered_map>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+namespace Zappy
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Immutable copy of the game state published by the network thread
+///
+/// A snapshot never changes once published, so the render thread reads it
+/// without any lock. Unchanged parts are shared with the previous snapshot:
+/// publishing only copies the regions, teams and tables that were modified
+/// since the last version.
+///
+///////////////////////////////////////////////////////////////////////////////
+class Snapshot
+{
+    friend class GameState;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Side length in tiles of the regions the map is split into
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr unsigned int REGION_SIZE = 32;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Square of REGION_SIZE tiles per side, shared between versions
+    ///
+    /// Tiles are stored row by row with a stride of REGION_SIZE, even on the
+    /// map borders. The IDs of the players standing on local tile i are
+    /// occupants[offsets[i]] to occupants[offsets[i + 1]].
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Region
+    {
+        std::vector<Inventory> tiles;       //<! Tile contents
+        Inventory resources;                //<! Sum of the tile contents
+        std::vector<unsigned int> offsets;  //<! First occupant of each tile
+        std::vector<unsigned int> occupants; //<! Player IDs by tile
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Location of a player inside the team storage
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct PlayerLocation
+    {
+        size_t team;                        //<! Index of the team
+        Team::PlayerHandle handle;          //<! Handle of the player in the team
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Player locations by ID
+    ///////////////////////////////////////////////////////////////////////////
+    using PlayerTable = std::unordered_map<unsigned int, PlayerLocation>;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private members
+    ///////////////////////////////////////////////////////////////////////////
+    std::uint64_t m_version;            //<! Publication number
+    unsigned int m_width;               //<! Width of the game map
+    unsigned int m_height;              //<! Height of the game map
+    unsigned int m_frequency;           //<! Frequency of the game updates
+    unsigned int m_livingPlayers;       //<! Number of living players
+    unsigned int m_deadPlayers;         //<! Number of dead players
+    Inventory m_totalResources;         //<! Total resources on the map
+    std::vector<std::shared_ptr<const Region>> m_regions; //<! Map regions
+    std::vector<std::shared_ptr<const Team>> m_teams; //<! Teams
+    std::shared_ptr<const PlayerTable> m_players; //<! Players by ID
+    std::shared_ptr<const MessageLog> m_messages; //<! Messages
+    bool m_hasWin;                      //<! Flag to indicate a winner
+    std::shared_ptr<const Team> m_winner; //<! The winning team
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor of an empty snapshot
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Snapshot(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the publication number of the snapshot
+    ///
+    /// \return The version, increasing with every publication
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::uint64_t GetVersion(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the dimensions of the game map
+    ///
+    /// \return A tuple containing the width and height of the game map
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::tuple<unsigned int, unsigned int> GetDimensions(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the width of the game map
+    ///
+    /// \return The width of the game map
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    unsigned int GetWidth(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the height of the game map
+    ///
+    /// \return The height of the game map
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    unsigned int GetHeight(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the tile at the specified coordinates
+    ///
+    /// \param x The x-coordinate of the tile
+    /// \param y The y-coordinate of the tile
+    ///
+    /// \return A reference to the Inventory object at the specified tile
+    ///
+    /// \throw Exception if the coordinates are outside of the map
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const Inventory& GetTileAt(unsigned int x, unsigned int y) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the number of teams
+    ///
+    /// \return The number of teams
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t GetTeamCount(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get a team by its index
+    ///
+    /// \param index The index of the team, in order of announcement
+    ///
+    /// \return A reference to the team
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const Team& GetTeam(size_t index) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get all messages
+    ///
+    /// \return The log of the messages kept
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const MessageLog& GetMessages(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the total resources lying on the map
+    ///
+    /// \return A reference to the Inventory object representing the total
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const Inventory& GetTotalResources(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the resources lying on the region containing a tile
+    ///
+    /// \param x The x-coordinate of the tile
+    /// \param y The y-coordinate of the tile
+    ///
+    /// \return A reference to the Inventory object of the region
+    ///
+    /// \throw Exception if the coordinates are outside of the map
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const Inventory& GetRegionResources(unsigned int x, unsigned int y) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the frequency of the game updates
+    ///
+    /// \return The frequency of the game updates
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    unsigned int GetFrequency(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the number of living players
+    ///
+    /// \return The number of living players
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    unsigned int GetLivingPlayers(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the number of dead players
+    ///
+    /// \return The number of dead players
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    unsigned int GetDeadPlayers(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Check if someone has won the game
+    ///
+    /// \return True if there is a winner, false otherwise
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool HasWin(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the winning team
+    ///
+    /// \return A reference to the winning Team object
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const Team& GetWinner(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Calls a function for every living player on a tile
+    ///
+    /// Players are visited in the order they arrived on the tile, so the
+    /// last one visited is the most recent arrival.
+    ///
+    /// \tparam Function Callable taking a const Player& and the index of its
+    /// team, as given to GetTeam
+    ///
+    /// \param x The x-coordinate of the tile
+    /// \param y The y-coordinate of the tile
+    /// \param function The function to call
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Function>
+    void ForEachPlayerAt(
+        unsigned int x, unsigned int y, Function&& function
+    ) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Calls a function for every living player in a region
+    ///
+    /// The region is clamped to the map and visited row by row.
+    ///
+    /// \tparam Function Callable taking a const Player& and the index of its
+    /// team, as given to GetTeam
+    ///
+    /// \param left The first column of the region
+    /// \param top The first row of the region
+    /// \param right One past the last column of the region
+    /// \param bottom One past the last row of the region
+    /// \param function The function to call
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Function>
+    void ForEachPlayerIn(
+        unsigned int left,
+        unsigned int top,
+        unsigned int right,
+        unsigned int bottom,
+        Function&& function
+    ) const;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets the index of the region containing a tile
+    ///
+    /// \param x The x-coordinate of the tile
+    /// \param y The y-coordinate of the tile
+    ///
+    /// \return The index of the region in m_regions
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t GetRegionIndex(unsigned int x, unsigned int y) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets the index of a tile inside its region
+    ///
+    /// \param x The x-coordinate of the tile
+    /// \param y The y-coordinate of the tile
+    ///
+    /// \return The index of the tile in Region::tiles
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static size_t GetLocalIndex(unsigned int x, unsigned int y);
+};
+
+} // !namespace Zappy
+
+///////////////////////////////////////////////////////////////////////////////
+// Template implementations
+///////////////////////////////////////////////////////////////////////////////
+#include "Game/Snapshot.inl"
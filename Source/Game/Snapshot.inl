@@ -0,0 +1,71 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Game/Snapshot.hpp"
+#include <algorithm>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+namespace Zappy
+{
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Function>
+void Snapshot::ForEachPlayerAt(
+    unsigned int x,
+    unsigned int y,
+    Function&& function
+) const
+{
+    if (x >= m_width || y >= m_height)
+    {
+        return;
+    }
+
+    const Region& region = *m_regions[GetRegionIndex(x, y)];
+    size_t tile = GetLocalIndex(x, y);
+
+    for (
+        unsigned int i = region.offsets[tile];
+        i < region.offsets[tile + 1];
+        ++i
+    )
+    {
+        const PlayerLocation& location = m_players->at(region.occupants[i]);
+
+        function(
+            *m_teams[location.team]->GetPlayer(location.handle),
+            location.team
+        );
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Function>
+void Snapshot::ForEachPlayerIn(
+    unsigned int left,
+    unsigned int top,
+    unsigned int right,
+    unsigned int bottom,
+    Function&& function
+) const
+{
+    right = std::min(right, m_width);
+    bottom = std::min(bottom, m_height);
+
+    for (unsigned int y = top; y < bottom; ++y)
+    {
+        for (unsigned int x = left; x < right; ++x)
+        {
+            ForEachPlayerAt(x, y, function);
+        }
+    }
+}
+
+} // !namespace Zappy
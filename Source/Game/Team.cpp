@@ -2,7 +2,7 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Game/Team.hpp"
-#include <algorithm>
+#include <atomic>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Zappy
@@ -25,37 +25,63 @@ const std::string& Team::GetName(void) const
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Team::AddPlayer(const Player& player)
+Team::PlayerHandle Team::AddPlayer(const Player& player)
 {
-    m_players.push_back(player);
+    m_resources.Add(player.GetInventory());
+    return (m_players.Insert(std::make_shared<Player>(player)));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Team::RemovePlayer(const Player& player)
+void Team::RemovePlayer(PlayerHandle handle)
 {
-    auto it = std::remove_if(
-        m_players.begin(), m_players.end(),
-        [&player](const Player& p)
-        {
-            return (p.GetID() == player.GetID());
-        }
-    );
-
-    if (it != m_players.end())
+    const PlayerPtr* player = m_players.Get(handle);
+
+    if (player != nullptr)
     {
-        m_players.erase(it, m_players.end());
+        m_resources.Subtract((*player)->GetInventory());
+        m_players.Remove(handle);
         m_deadPlayers++;
     }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-const std::vector<Player>& Team::GetPlayers(void) const
+const Player* Team::GetPlayer(PlayerHandle handle) const
 {
-    return (m_players);
+    const PlayerPtr* player = m_players.Get(handle);
+
+    return (player != nullptr ? player->get() : nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Player* Team::EditPlayer(PlayerHandle handle)
+{
+    PlayerPtr* player = m_players.Get(handle);
+
+    if (player == nullptr)
+    {
+        return (nullptr);
+    }
+
+    // Copies are only made on this thread, so a count of one cannot grow
+    // behind our back; a stale count above one only costs a spare copy
+    if (player->use_count() > 1)
+    {
+        *player = std::make_shared<Player>(**player);
+    }
+    else
+    {
+        // use_count is a relaxed load: the fence pairs with the release
+        // decrement of the last snapshot dropped by the render thread, so
+        // its reads of the player happen before the writes that follow
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+
+    // Every player is created as a mutable object by make_shared
+    return (const_cast<Player*>(player->get()));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-std::vector<Player>& Team::GetPlayers(void)
+const SlotMap<Team::PlayerPtr>& Team::GetPlayers(void) const
 {
     return (m_players);
 }
@@ -63,7 +89,7 @@ std::vector<Player>& Team::GetPlayers(void)
 ///////////////////////////////////////////////////////////////////////////////
 unsigned int Team::GetLivingPlayers(void) const
 {
-    return (static_cast<unsigned int>(m_players.size()));
+    return (static_cast<unsigned int>(m_players.GetSize()));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -90,4 +116,17 @@ void Team::SetMaxLevel(unsigned int maxLevel)
     m_maxLevel = maxLevel;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+const Inventory& Team::GetResources(void) const
+{
+    return (m_resources);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Team::UpdateResources(const Inventory& before, const Inventory& after)
+{
+    m_resources.Subtract(before);
+    m_resources.Add(after);
+}
+
 } // !namespace Zappy
@@ -7,8 +7,9 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Game/Player.hpp"
-#include <vector>
+#include "Utils/SlotMap.hpp"
 #include <SFML/Graphics/Color.hpp>
+#include <memory>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Zappy
@@ -19,18 +20,31 @@ namespace Zappy
 ///////////////////////////////////////////////////////////////////////////////
 /// \brief
 ///
+/// Players are held through shared pointers, so copying a team into a
+/// snapshot only shares them. A player still referenced by a copy is
+/// copied on the first write through EditPlayer, leaving the published
+/// one untouched.
+///
 ///////////////////////////////////////////////////////////////////////////////
 class Team
 {
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    // Type definitions
+    ///////////////////////////////////////////////////////////////////////////
+    using PlayerPtr = std::shared_ptr<const Player>;
+    using PlayerHandle = SlotMap<PlayerPtr>::Handle;
+
 private:
     ///////////////////////////////////////////////////////////////////////////
     // Public members
     ///////////////////////////////////////////////////////////////////////////
     std::string m_name;             //<! Team name
-    std::vector<Player> m_players;  //<! Players in the team
+    SlotMap<PlayerPtr> m_players;   //<! Players in the team
     unsigned int m_deadPlayers;     //<! Number of dead players in the team
     sf::Color m_color;              //<! Team color
     unsigned int m_maxLevel;        //<! Maximum level of the team
+    Inventory m_resources;          //<! Resources carried by the players
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -52,32 +66,50 @@ public:
     ///
     /// \param player The player to add
     ///
+    /// \return The handle of the player, valid until it is removed
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void AddPlayer(const Player& player);
+    PlayerHandle AddPlayer(const Player& player);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Removes a player from the team
     ///
-    /// \param player The player to remove
+    /// \param handle The handle of the player to remove
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void RemovePlayer(const Player& player);
+    void RemovePlayer(PlayerHandle handle);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Gets the players in the team
+    /// \brief Gets a player of the team
+    ///
+    /// \param handle The handle of the player
+    ///
+    /// \return A pointer to the player, nullptr if it has been removed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const Player* GetPlayer(PlayerHandle handle) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets a player of the team for writing
     ///
-    /// \return A reference to the vector of players
+    /// The player is copied first if a copy of the team still shares it.
+    ///
+    /// \param handle The handle of the player
+    ///
+    /// \return A pointer to the player, nullptr if it has been removed
     ///
     ///////////////////////////////////////////////////////////////////////////
-    const std::vector<Player>& GetPlayers(void) const;
+    Player* EditPlayer(PlayerHandle handle);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Gets the players in the team
     ///
-    /// \return A reference to the vector of players
+    /// The order of the players changes when one of them is removed.
+    ///
+    /// \return A reference to the slot map of players
     ///
     ///////////////////////////////////////////////////////////////////////////
-    std::vector<Player>& GetPlayers(void);
+    const SlotMap<PlayerPtr>& GetPlayers(void) const;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Gets the number of living players in the team
@@ -118,6 +150,23 @@ public:
     ///
     ///////////////////////////////////////////////////////////////////////////
     void SetMaxLevel(unsigned int maxLevel);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets the resources carried by the living players of the team
+    ///
+    /// \return The sum of the players inventories
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const Inventory& GetResources(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Applies a change of a player inventory to the team resources
+    ///
+    /// \param before The player inventory before the change
+    /// \param after The player inventory after the change
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void UpdateResources(const Inventory& before, const Inventory& after);
 };
 
 } // !namespace Zappy
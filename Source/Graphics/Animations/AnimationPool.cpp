@@ -0,0 +1,261 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Graphics/Animations/AnimationPool.hpp"
+#include <algorithm>
+#include <cmath>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+namespace Zappy
+{
+
+///////////////////////////////////////////////////////////////////////////////
+AnimationPool::AnimationPool(void)
+    : m_square{{{-1.f, -1.f}, {1.f, -1.f}, {1.f, 1.f}, {-1.f, 1.f}}}
+    , m_vertices(sf::Triangles)
+{
+    static constexpr float PI = 3.141592654f;
+
+    for (size_t i = 0; i < RING_POINTS; ++i)
+    {
+        float angle = static_cast<float>(i) * 2.f * PI / RING_POINTS - PI / 2.f;
+
+        m_ring[i] = sf::Vector2f(std::cos(angle), std::sin(angle));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AnimationPool::Spawn(
+    Shape shape,
+    std::uint32_t tile,
+    std::uint32_t group,
+    float x,
+    float y,
+    float size,
+    float duration,
+    const sf::Color& color,
+    unsigned int intensity
+)
+{
+    std::uint64_t key = MergeKey(tile, group, shape);
+    auto latest = m_latest.find(key);
+    std::uint32_t& count = m_tileCounts[tile];
+
+    if (
+        latest != m_latest.end() &&
+        (m_elapsed[latest->second] < MERGE_WINDOW || count >= MAX_PER_TILE)
+    )
+    {
+        m_intensity[latest->second] += intensity;
+        return;
+    }
+    if (count >= MAX_PER_TILE)
+    {
+        return;
+    }
+
+    count++;
+    m_latest[key] = static_cast<std::uint32_t>(m_elapsed.size());
+    m_x.push_back(x);
+    m_y.push_back(y);
+    m_size.push_back(size);
+    m_duration.push_back(duration);
+    m_elapsed.push_back(0.f);
+    m_color.push_back(color);
+    m_shape.push_back(shape);
+    m_tile.push_back(tile);
+    m_group.push_back(group);
+    m_intensity.push_back(intensity);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AnimationPool::Update(float deltaTime)
+{
+    // Walking backward, the last animation moved into the place of a
+    // finished one has already been advanced
+    for (size_t i = m_elapsed.size(); i-- > 0;)
+    {
+        m_elapsed[i] += deltaTime;
+        if (m_elapsed[i] >= m_duration[i])
+        {
+            Remove(i);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AnimationPool::Build(const sf::FloatRect& bounds)
+{
+    m_vertices.clear();
+
+    for (size_t i = 0; i < m_elapsed.size(); ++i)
+    {
+        if (!bounds.contains(m_x[i], m_y[i]))
+        {
+            continue;
+        }
+
+        float progress = m_elapsed[i] / m_duration[i];
+        float size = m_size[i] * progress;
+        sf::Color color = m_color[i];
+        float thickness = OUTLINE_THICKNESS * std::min(
+            1.f + std::log2(static_cast<float>(m_intensity[i])),
+            MAX_THICKNESS_SCALE
+        );
+
+        color.a = static_cast<sf::Uint8>(255.f * (1.f - progress));
+
+        // Like an SFML shape outline, the band grows outward from the edge
+        if (m_shape[i] == Shape::Ring)
+        {
+            AppendOutline(
+                m_ring.data(), m_ring.size(), {m_x[i], m_y[i]},
+                size, size + thickness, color
+            );
+        }
+        else
+        {
+            AppendOutline(
+                m_square.data(), m_square.size(), {m_x[i], m_y[i]},
+                size / 2.f, size / 2.f + thickness, color
+            );
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool AnimationPool::Render(sf::RenderTarget& target) const
+{
+    if (m_vertices.getVertexCount() == 0)
+    {
+        return (false);
+    }
+    target.draw(m_vertices);
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AnimationPool::Clear(void)
+{
+    m_x.clear();
+    m_y.clear();
+    m_size.clear();
+    m_duration.clear();
+    m_elapsed.clear();
+    m_color.clear();
+    m_shape.clear();
+    m_tile.clear();
+    m_group.clear();
+    m_intensity.clear();
+    m_tileCounts.clear();
+    m_latest.clear();
+    m_vertices.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool AnimationPool::IsEmpty(void) const
+{
+    return (m_elapsed.empty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t AnimationPool::GetSize(void) const
+{
+    return (m_elapsed.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t AnimationPool::MergeKey(
+    std::uint32_t tile, std::uint32_t group, Shape shape
+)
+{
+    return (
+        (static_cast<std::uint64_t>(tile) << 32) |
+        (static_cast<std::uint64_t>(group) << 1) |
+        static_cast<std::uint64_t>(shape)
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AnimationPool::Remove(size_t index)
+{
+    auto latest = m_latest.find(
+        MergeKey(m_tile[index], m_group[index], m_shape[index])
+    );
+
+    if (latest != m_latest.end() && latest->second == index)
+    {
+        m_latest.erase(latest);
+    }
+    if (--m_tileCounts[m_tile[index]] == 0)
+    {
+        m_tileCounts.erase(m_tile[index]);
+    }
+
+    size_t last = m_elapsed.size() - 1;
+
+    if (index != last)
+    {
+        latest = m_latest.find(
+            MergeKey(m_tile[last], m_group[last], m_shape[last])
+        );
+        if (latest != m_latest.end() && latest->second == last)
+        {
+            latest->second = static_cast<std::uint32_t>(index);
+        }
+
+        m_x[index] = m_x[last];
+        m_y[index] = m_y[last];
+        m_size[index] = m_size[last];
+        m_duration[index] = m_duration[last];
+        m_elapsed[index] = m_elapsed[last];
+        m_color[index] = m_color[last];
+        m_shape[index] = m_shape[last];
+        m_tile[index] = m_tile[last];
+        m_group[index] = m_group[last];
+        m_intensity[index] = m_intensity[last];
+    }
+
+    m_x.pop_back();
+    m_y.pop_back();
+    m_size.pop_back();
+    m_duration.pop_back();
+    m_elapsed.pop_back();
+    m_color.pop_back();
+    m_shape.pop_back();
+    m_tile.pop_back();
+    m_group.pop_back();
+    m_intensity.pop_back();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AnimationPool::AppendOutline(
+    const sf::Vector2f* points,
+    size_t count,
+    const sf::Vector2f& center,
+    float inner,
+    float outer,
+    const sf::Color& color
+)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        const sf::Vector2f& p = points[i];
+        const sf::Vector2f& q = points[(i + 1) % count];
+        sf::Vector2f a = center + p * inner;
+        sf::Vector2f b = center + p * outer;
+        sf::Vector2f c = center + q * outer;
+        sf::Vector2f d = center + q * inner;
+
+        m_vertices.append(sf::Vertex(a, color));
+        m_vertices.append(sf::Vertex(b, color));
+        m_vertices.append(sf::Vertex(c, color));
+        m_vertices.append(sf::Vertex(a, color));
+        m_vertices.append(sf::Vertex(c, color));
+        m_vertices.append(sf::Vertex(d, color));
+    }
+}
+
+} // !namespace Zappy
@@ -0,0 +1,218 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <array>
+#include <unordered_map>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+namespace Zappy
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Pool of the expanding outlines drawn over the map
+///
+/// Every animation is a handful of plain values stored in parallel arrays,
+/// so updating them is a linear walk and a finished one is replaced by the
+/// last. The outlines of all the visible animations are generated into a
+/// single vertex array, drawn in one call.
+///
+/// Animations spawned on the same tile for the same group and shape within
+/// MERGE_WINDOW are merged into one whose intensity thickens its outline,
+/// and a tile never holds more than MAX_PER_TILE of them, so the cost of a
+/// frame is bounded by the visible tiles however fast events arrive.
+///
+///////////////////////////////////////////////////////////////////////////////
+class AnimationPool
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Outline drawn by an animation
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    enum class Shape : std::uint8_t
+    {
+        Ring,
+        Square
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Outline thickness, scaled up with the number of merged events
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr float OUTLINE_THICKNESS = 2.f;
+    static constexpr float MAX_THICKNESS_SCALE = 4.f;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // How far an outline reaches past the size of its animation
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr float MAX_OUTLINE_THICKNESS =
+        OUTLINE_THICKNESS * MAX_THICKNESS_SCALE;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Constants
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t RING_POINTS = 30;
+    static constexpr float MERGE_WINDOW = 0.25f;
+    static constexpr std::uint32_t MAX_PER_TILE = 4;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private members
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<float> m_x;             //< The X positions of the centers
+    std::vector<float> m_y;             //< The Y positions of the centers
+    std::vector<float> m_size;          //< The sizes reached at the end
+    std::vector<float> m_duration;      //< The durations in seconds
+    std::vector<float> m_elapsed;       //< The time spent since spawning
+    std::vector<sf::Color> m_color;     //< The outline colors
+    std::vector<Shape> m_shape;         //< The outlines drawn
+    std::vector<std::uint32_t> m_tile;  //< The tiles the animations belong to
+    std::vector<std::uint32_t> m_group; //< The groups animations merge within
+    std::vector<std::uint32_t> m_intensity; //< The number of merged events
+    std::unordered_map<std::uint32_t, std::uint32_t> m_tileCounts; //< By tile
+    std::unordered_map<std::uint64_t, std::uint32_t> m_latest; //< Merge targets
+    std::array<sf::Vector2f, RING_POINTS> m_ring; //< The unit circle points
+    std::array<sf::Vector2f, 4> m_square; //< The unit square corners
+    sf::VertexArray m_vertices;         //< The outlines built by the last frame
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor of an empty pool
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AnimationPool(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Start an animation, or merge it into a recent one
+    ///
+    /// The animation is merged into the newest one of its tile, group and
+    /// shape if it started less than MERGE_WINDOW ago or if the tile is
+    /// full. It is dropped if the tile is full and holds none to merge into.
+    ///
+    /// \param shape The outline drawn by the animation
+    /// \param tile The index of the tile the animation belongs to
+    /// \param group The group the animation merges within, such as a team
+    /// \param x The X position of the center
+    /// \param y The Y position of the center
+    /// \param size The radius of a ring or the side of a square at the end
+    /// \param duration The duration in seconds
+    /// \param color The outline color, faded out over the duration
+    /// \param intensity The number of events the animation stands for
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Spawn(
+        Shape shape,
+        std::uint32_t tile,
+        std::uint32_t group,
+        float x,
+        float y,
+        float size,
+        float duration,
+        const sf::Color& color,
+        unsigned int intensity = 1
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Advance every animation and remove the finished ones
+    ///
+    /// \param deltaTime The time elapsed since the last update, in seconds
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Update(float deltaTime);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Generate the outlines of the animations centered in an area
+    ///
+    /// \param bounds The area holding the centers of the drawn animations
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Build(const sf::FloatRect& bounds);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Draw the outlines generated by Build in a single draw call
+    ///
+    /// \param target The target to draw on
+    ///
+    /// \return True if something was drawn, false otherwise
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool Render(sf::RenderTarget& target) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remove every animation, keeping the capacity
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Clear(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Check if no animation is running
+    ///
+    /// \return True if the pool is empty, false otherwise
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool IsEmpty(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the number of running animations
+    ///
+    /// \return The number of animations
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t GetSize(void) const;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Build the key of the merge index
+    ///
+    /// \param tile The index of the tile
+    /// \param group The group of the animation
+    /// \param shape The shape of the animation
+    ///
+    /// \return The key of m_latest
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::uint64_t MergeKey(
+        std::uint32_t tile, std::uint32_t group, Shape shape
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remove an animation, moving the last one into its place
+    ///
+    /// \param index The index of the animation to remove
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Remove(size_t index);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Append a closed outline as a band of triangles
+    ///
+    /// \param points The unit points of the outline, in order
+    /// \param count The number of points
+    /// \param center The center of the outline
+    /// \param inner The scale of the inner edge
+    /// \param outer The scale of the outer edge
+    /// \param color The color of the outline
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void AppendOutline(
+        const sf::Vector2f* points,
+        size_t count,
+        const sf::Vector2f& center,
+        float inner,
+        float outer,
+        const sf::Color& color
+    );
+};
+
+} // !namespace Zappy
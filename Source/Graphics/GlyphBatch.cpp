@@ -0,0 +1,116 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Graphics/GlyphBatch.hpp"
+#include <charconv>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+namespace Zappy
+{
+
+///////////////////////////////////////////////////////////////////////////////
+GlyphBatch::GlyphBatch(void)
+    : m_texture(nullptr)
+    , m_digits()
+    , m_baseline(0.f)
+    , m_vertices(sf::Triangles)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+void GlyphBatch::Bake(const sf::Font& font, unsigned int characterSize)
+{
+    // Same padding as sf::Text to avoid clipping the smoothed glyph edges
+    static constexpr float PADDING = 1.f;
+
+    for (unsigned int digit = 0; digit < m_digits.size(); ++digit)
+    {
+        const sf::Glyph& glyph = font.getGlyph(
+            '0' + digit, characterSize, false
+        );
+
+        m_digits[digit].bounds = sf::FloatRect(
+            glyph.bounds.left - PADDING,
+            glyph.bounds.top - PADDING,
+            glyph.bounds.width + 2.f * PADDING,
+            glyph.bounds.height + 2.f * PADDING
+        );
+        m_digits[digit].texture = sf::FloatRect(
+            static_cast<float>(glyph.textureRect.left) - PADDING,
+            static_cast<float>(glyph.textureRect.top) - PADDING,
+            static_cast<float>(glyph.textureRect.width) + 2.f * PADDING,
+            static_cast<float>(glyph.textureRect.height) + 2.f * PADDING
+        );
+        m_digits[digit].advance = glyph.advance;
+    }
+
+    // The texture is only fetched once every digit has been added to it
+    m_texture = &font.getTexture(characterSize);
+    m_baseline = static_cast<float>(characterSize);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool GlyphBatch::IsBaked(void) const
+{
+    return (m_texture != nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void GlyphBatch::Clear(void)
+{
+    m_vertices.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void GlyphBatch::Append(
+    unsigned int value,
+    float x,
+    float y,
+    const sf::Color& color
+)
+{
+    char digits[16];
+    auto [end, ec] = std::to_chars(digits, digits + sizeof(digits), value);
+
+    (void)ec;
+    y += m_baseline;
+
+    for (const char* it = digits; it != end; ++it)
+    {
+        const Glyph& glyph = m_digits[*it - '0'];
+        float left = x + glyph.bounds.left;
+        float top = y + glyph.bounds.top;
+        float right = left + glyph.bounds.width;
+        float bottom = top + glyph.bounds.height;
+        float u1 = glyph.texture.left;
+        float v1 = glyph.texture.top;
+        float u2 = u1 + glyph.texture.width;
+        float v2 = v1 + glyph.texture.height;
+
+        m_vertices.append(sf::Vertex({left, top}, color, {u1, v1}));
+        m_vertices.append(sf::Vertex({right, top}, color, {u2, v1}));
+        m_vertices.append(sf::Vertex({left, bottom}, color, {u1, v2}));
+        m_vertices.append(sf::Vertex({left, bottom}, color, {u1, v2}));
+        m_vertices.append(sf::Vertex({right, top}, color, {u2, v1}));
+        m_vertices.append(sf::Vertex({right, bottom}, color, {u2, v2}));
+
+        x += glyph.advance;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void GlyphBatch::Render(sf::RenderTarget& target) const
+{
+    if (!m_texture || m_vertices.getVertexCount() == 0)
+    {
+        return;
+    }
+
+    sf::RenderStates states;
+
+    states.texture = m_texture;
+    target.draw(m_vertices, states);
+}
+
+} // !namespace Zappy
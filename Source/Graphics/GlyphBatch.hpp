@@ -0,0 +1,102 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <SFML/Graphics.hpp>
+#include <array>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+namespace Zappy
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Batches numbers into a single vertex array of glyph quads
+///
+/// The digit glyphs are looked up once in the font, so appending a number
+/// only writes vertices: no string, no glyph layout and no draw call per
+/// number. The whole batch is then drawn at once with the font texture.
+///
+///////////////////////////////////////////////////////////////////////////////
+class GlyphBatch
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Pre-computed quad of a digit
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Glyph
+    {
+        sf::FloatRect bounds;   //< Quad relative to the pen position
+        sf::FloatRect texture;  //< Quad in the font texture
+        float advance;          //< Horizontal offset to the next glyph
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private members
+    ///////////////////////////////////////////////////////////////////////////
+    const sf::Texture* m_texture;   //< The font texture holding the digits
+    std::array<Glyph, 10> m_digits; //< The baked digit glyphs
+    float m_baseline;               //< Offset from the top to the baseline
+    sf::VertexArray m_vertices;     //< The quads appended since Clear
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor for the GlyphBatch class
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    GlyphBatch(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Look up the digit glyphs of a font at a character size
+    ///
+    /// \param font The font to take the glyphs from, it must outlive the batch
+    /// \param characterSize The character size in pixels
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Bake(const sf::Font& font, unsigned int characterSize);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Check if the glyphs have been baked
+    ///
+    /// \return True if numbers can be appended, false otherwise
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool IsBaked(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remove every number from the batch, keeping its capacity
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Clear(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Append a number to the batch
+    ///
+    /// The number is laid out like an sf::Text placed at the same position.
+    ///
+    /// \param value The number to append
+    /// \param x The X position of the top left corner of the number
+    /// \param y The Y position of the top left corner of the number
+    /// \param color The color of the number
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Append(unsigned int value, float x, float y, const sf::Color& color);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Draw every number of the batch in a single draw call
+    ///
+    /// \param target The target to draw on
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Render(sf::RenderTarget& target) const;
+};
+
+} // !namespace Zappy
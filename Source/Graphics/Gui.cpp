@@ -7,6 +7,7 @@
 #include "Libraries/imgui.h"
 #include "Libraries/imgui-SFML.h"
 #include "Libraries/imgui_internal.h"
+#include <array>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Zappy
@@ -20,6 +21,13 @@ Gui::Gui(sf::RenderWindow& window)
     , m_currentX(0)
     , m_currentY(0)
     , m_debug(false)
+    , m_logFilter(
+        Message::GetTypeMask(Message::Type::Broadcast) |
+        Message::GetTypeMask(Message::Type::Egg) |
+        Message::GetTypeMask(Message::Type::Incantation) |
+        Message::GetTypeMask(Message::Type::Resource) |
+        Message::GetTypeMask(Message::Type::Victory)
+    )
 {
     if (!ImGui::SFML::Init(m_window))
     {
@@ -83,6 +91,45 @@ void Gui::Render(Viewport& viewport)
         );
         ImGui::Text("FPS: %.1f", ImGui::GetIO().Framerate);
         ImGui::Text("Frame Time: %.3f ms", ImGui::GetIO().DeltaTime * 1000.0f);
+        ImGui::Text("Viewport Draw Calls: %u", viewport.GetDrawCalls());
+
+        Socket::Statistics net = GameState::GetInstance().GetNetworkStatistics();
+        ImGui::Text("Network: %.1f KiB/s | %.0f lines/s",
+            net.bytesPerSecond / 1024.0, net.linesPerSecond);
+
+        GameState::IngestStatistics ingest =
+            GameState::GetInstance().GetIngestStatistics();
+        ImGui::Text("Network Wake-ups: %llu",
+            static_cast<unsigned long long>(ingest.wakeups));
+        ImGui::Text("Dispatch Latency: %.1f us (max %.1f us)",
+            ingest.latencyAverage, ingest.latencyMax);
+        ImGui::Text("Dispatch Allocations: %llu (last batch of %u lines)",
+            static_cast<unsigned long long>(ingest.batchAllocations),
+            ingest.batchLines);
+        ImGui::Text("Publish Allocations: %llu (last snapshot)",
+            static_cast<unsigned long long>(ingest.publishAllocations));
+        ImGui::Text("Parse Throughput: %.0f lines/s", ingest.parseRate);
+        ImGui::Text("Malformed Lines: %llu",
+            static_cast<unsigned long long>(ingest.malformedLines));
+        for (size_t c = 0; c < ingest.errors.size(); ++c)
+        {
+            for (size_t e = 0; e < ingest.errors[c].size(); ++e)
+            {
+                if (ingest.errors[c][e] == 0)
+                {
+                    continue;
+                }
+                ImGui::Text("  %s: %s x%llu",
+                    GameState::GetCommandName(
+                        static_cast<GameState::Command>(c)),
+                    GameState::GetErrorName(
+                        static_cast<GameState::ParseError>(e)),
+                    static_cast<unsigned long long>(ingest.errors[c][e]));
+            }
+        }
+        ImGui::Text("Animations: %llu coalesced, %llu dropped",
+            static_cast<unsigned long long>(ingest.coalescedAnimations),
+            static_cast<unsigned long long>(ingest.droppedAnimations));
         ImGui::End();
     }
 
@@ -117,33 +164,33 @@ void Gui::RenderViewport(Viewport& viewport)
 ///////////////////////////////////////////////////////////////////////////////
 void Gui::RenderLogs(void)
 {
-    GameState& gs = GameState::GetInstance();
-
     ImGui::Begin("Logs");
 
     ImGui::Text("Game Logs:");
-    GameState::ScopedLock lock(gs);
-    const auto& logs = gs.GetMessages();
+    std::shared_ptr<const Snapshot> snapshot =
+        GameState::GetInstance().GetSnapshot();
+    const auto& logs = snapshot->GetMessages();
 
     if (ImGui::TreeNode("Filter Options"))
     {
-        ImGui::Checkbox("Broadcast", &m_BroadcastLogs);
-        ImGui::SameLine();
-        ImGui::Checkbox("Egg", &m_EggLogs);
-        ImGui::SameLine();
-        ImGui::Checkbox("Event", &m_EventLogs);
-
-        ImGui::Checkbox("Incantation", &m_IncantationLogs);
-        ImGui::SameLine();
-        ImGui::Checkbox("Resource", &m_ResourceLogs);
-        ImGui::SameLine();
-        ImGui::Checkbox("Death", &m_DeathLogs);
+        for (
+            unsigned int t = 0;
+            t < static_cast<unsigned int>(Message::Type::Count);
+            ++t
+        )
+        {
+            Message::Type type = static_cast<Message::Type>(t);
 
-        ImGui::Checkbox("Victory", &m_VictoryLogs);
-        ImGui::SameLine();
-        ImGui::Checkbox("Info", &m_InfoLogs);
-        ImGui::SameLine();
-        ImGui::Checkbox("Error", &m_ErrorLogs);
+            if (t % 3 != 0)
+            {
+                ImGui::SameLine();
+            }
+            ImGui::CheckboxFlags(
+                Message::GetTypeName(type),
+                &m_logFilter,
+                Message::GetTypeMask(type)
+            );
+        }
         ImGui::TreePop();
     }
 
@@ -152,39 +199,30 @@ void Gui::RenderLogs(void)
     static float rainbowTime = 0.0f;
     rainbowTime += ImGui::GetIO().DeltaTime;
 
-    for (auto it = logs.rbegin(); it != logs.rend(); ++it)
+    m_logRows.clear();
+    logs.ForEachNewest([this](const Message& log)
     {
-        const auto& log = *it;
-        const std::string& type = log.GetType();
-
-        // Filter based on log type
-        bool showLog = false;
-
-        if (type == "Broadcast" && m_BroadcastLogs)
-            showLog = true;
-        else if (type == "Egg" && m_EggLogs)
-            showLog = true;
-        else if (type == "Event" && m_EventLogs)
-            showLog = true;
-        else if (type == "Incantation" && m_IncantationLogs)
-            showLog = true;
-        else if (type == "Resource" && m_ResourceLogs)
-            showLog = true;
-        else if (type == "Death" && m_DeathLogs)
-            showLog = true;
-        else if (type == "Victory" && m_VictoryLogs)
-            showLog = true;
-        else if (type == "Info" && m_InfoLogs)
-            showLog = true;
-        else if (type == "Error" && m_ErrorLogs)
-            showLog = true;
-
-        if (showLog)
+        if (m_logFilter & Message::GetTypeMask(log.GetType()))
         {
-            if (type == "Victory") {
+            m_logRows.push_back(&log);
+        }
+    });
+
+    // Only the rows scrolled into view are formatted
+    ImGuiListClipper clipper;
+
+    clipper.Begin(static_cast<int>(m_logRows.size()));
+    while (clipper.Step())
+    {
+        for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
+        {
+            const Message& log = *m_logRows[row];
+
+            logs.Format(log, m_logText);
+            if (log.GetType() == Message::Type::Victory) {
                 ImVec4 origColor = ImGui::GetStyle().Colors[ImGuiCol_Text];
 
-                const std::string& content = log.GetContent();
+                const std::string& content = m_logText;
                 for (size_t i = 0; i < content.size(); i++) {
                     float hue = rainbowTime * 2.0f + i * 0.02f;
                     ImVec4 color = ImVec4(0.0f, 0.0f, 0.0f, 1.0f);
@@ -200,10 +238,13 @@ void Gui::RenderLogs(void)
                 ImGui::PushStyleColor(ImGuiCol_Text, origColor);
                 ImGui::PopStyleColor();
             } else {
-                ImGui::Text("%s", log.GetContent().c_str());
+                ImGui::TextUnformatted(
+                    m_logText.data(), m_logText.data() + m_logText.size()
+                );
             }
         }
     }
+    clipper.End();
 
     ImGui::End();
 }
@@ -211,24 +252,24 @@ void Gui::RenderLogs(void)
 ///////////////////////////////////////////////////////////////////////////////
 void Gui::RenderCurrentGame(void)
 {
-    GameState& gs = GameState::GetInstance();
-
-    GameState::ScopedLock lock(gs);
+    std::shared_ptr<const Snapshot> snapshot =
+        GameState::GetInstance().GetSnapshot();
 
     ImGui::Begin("Current Game");
 
     ImGui::SetWindowFontScale(2.f);
 
-    ImGui::Text("Current Frequency: %d", gs.GetFrequency());
-    ImGui::Text("Map Size: %d x %d", gs.GetWidth(), gs.GetHeight());
-    ImGui::Text("Players Alive: %d", gs.GetLivingPlayers());
-    ImGui::Text("Players Dead: %d", gs.GetDeadPlayers());
+    ImGui::Text("Current Frequency: %d", snapshot->GetFrequency());
+    ImGui::Text("Map Size: %d x %d", snapshot->GetWidth(), snapshot->GetHeight());
+    ImGui::Text("Players Alive: %d", snapshot->GetLivingPlayers());
+    ImGui::Text("Players Dead: %d", snapshot->GetDeadPlayers());
 
-    const auto& teams = gs.GetTeams();
-    ImGui::Text("Teams: %d", static_cast<int>(teams.size()));
+    ImGui::Text("Teams: %d", static_cast<int>(snapshot->GetTeamCount()));
     ImGui::SameLine();
-    for (const auto& team : teams)
+    for (size_t t = 0; t < snapshot->GetTeamCount(); ++t)
     {
+        const Team& team = snapshot->GetTeam(t);
+
         ImGui::PushStyleColor(ImGuiCol_Text, ConvertColor(team.GetColor()));
         ImGui::Text("%s", team.GetName().c_str());
         ImGui::PopStyleColor();
@@ -241,7 +282,7 @@ void Gui::RenderCurrentGame(void)
 
     ImGui::Text("Total Resources:");
 
-    const Inventory& totalResources = gs.GetTotalResources();
+    const Inventory& totalResources = snapshot->GetTotalResources();
 
     totalResources.DrawInvText();
 
@@ -250,8 +291,10 @@ void Gui::RenderCurrentGame(void)
     ImGui::Dummy(ImVec2(0.0f, 5.0f));
 
     ImGui::Text("Players per Team:");
-    for (const auto& team : teams)
+    for (size_t t = 0; t < snapshot->GetTeamCount(); ++t)
     {
+        const Team& team = snapshot->GetTeam(t);
+
         ImGui::PushStyleColor(ImGuiCol_Text, ConvertColor(team.GetColor()));
 
         const auto& players = team.GetPlayers();
@@ -260,7 +303,7 @@ void Gui::RenderCurrentGame(void)
 
         for (const auto& player : players)
         {
-            levelCount[player.GetLevel()]++;
+            levelCount[player->GetLevel()]++;
         }
 
         int maxLevel = 1;
@@ -280,6 +323,9 @@ void Gui::RenderCurrentGame(void)
         if (open)
         {
             ImGui::Text("Players: %d | Current Level: %d", team.GetLivingPlayers(), maxLevel);
+            ImGui::Text("Carried:");
+            ImGui::SameLine();
+            team.GetResources().DrawInvNumb();
 
             for (unsigned int level = 8; level > 0; level--) {
                 ImGui::Separator();
@@ -289,12 +335,12 @@ void Gui::RenderCurrentGame(void)
                 if (ImGui::TreeNode(levelStr.c_str())) {
                     for (const auto& player : players)
                     {
-                        if (player.GetLevel() == level)
+                        if (player->GetLevel() == level)
                         {
-                            ImGui::Text("%s (ID: %d)", player.GetName().c_str(),
-                                        player.GetID());
+                            ImGui::Text("%s (ID: %d)", player->GetName().c_str(),
+                                        player->GetID());
                             ImGui::SameLine();
-                            player.GetInventory().DrawInvNumb();
+                            player->GetInventory().DrawInvNumb();
                         }
                     }
                     ImGui::TreePop();
@@ -309,15 +355,14 @@ void Gui::RenderCurrentGame(void)
 ///////////////////////////////////////////////////////////////////////////////
 void Gui::RenderTileInspector(Viewport& viewport)
 {
-    GameState& gs = GameState::GetInstance();
-
-    GameState::ScopedLock lock(gs);
+    std::shared_ptr<const Snapshot> snapshot =
+        GameState::GetInstance().GetSnapshot();
 
     ImGui::Begin("Tile Inspector");
 
     ImGui::Text("Current Tile: (%d, %d)", viewport.m_indexX, viewport.m_indexY);
 
-    const Inventory& inv = gs.GetTileAt(viewport.m_indexX, viewport.m_indexY);
+    const Inventory& inv = snapshot->GetTileAt(viewport.m_indexX, viewport.m_indexY);
 
     inv.DrawInvText();
 
@@ -325,29 +370,43 @@ void Gui::RenderTileInspector(Viewport& viewport)
     ImGui::Separator();
     ImGui::Dummy(ImVec2(0.0f, 5.0f));
 
+    ImGui::Text("Region (%d, %d):",
+        viewport.m_indexX / GameState::REGION_SIZE,
+        viewport.m_indexY / GameState::REGION_SIZE);
+    ImGui::SameLine();
+    snapshot->GetRegionResources(viewport.m_indexX, viewport.m_indexY).DrawInvNumb();
+
+    ImGui::Dummy(ImVec2(0.0f, 5.0f));
+    ImGui::Separator();
+    ImGui::Dummy(ImVec2(0.0f, 5.0f));
+
     int num = 0;
-    for (const auto& team : gs.GetTeams())
+    for (size_t t = 0; t < snapshot->GetTeamCount(); ++t)
     {
+        const Team& team = snapshot->GetTeam(t);
+
         for (const auto& player : team.GetPlayers())
         {
-            if (player.GetX() == viewport.m_indexX && player.GetY() == viewport.m_indexY)
+            if (player->GetX() == viewport.m_indexX && player->GetY() == viewport.m_indexY)
             {
                 num++;
             }
         }
     }
     ImGui::Text("Players on Tile: %d", num);
-    for (const auto& team : gs.GetTeams())
+    for (size_t t = 0; t < snapshot->GetTeamCount(); ++t)
     {
+        const Team& team = snapshot->GetTeam(t);
+
         ImGui::PushStyleColor(ImGuiCol_Text, ConvertColor(team.GetColor()));
 
         for (const auto& player : team.GetPlayers())
         {
-            if (player.GetX() == viewport.m_indexX && player.GetY() == viewport.m_indexY)
+            if (player->GetX() == viewport.m_indexX && player->GetY() == viewport.m_indexY)
             {
-                ImGui::Text("%s (ID: %d, Level: %d)", player.GetName().c_str(),
-                            player.GetID(), player.GetLevel());
-                player.GetInventory().DrawInvNumb();
+                ImGui::Text("%s (ID: %d, Level: %d)", player->GetName().c_str(),
+                            player->GetID(), player->GetLevel());
+                player->GetInventory().DrawInvNumb();
             }
         }
 
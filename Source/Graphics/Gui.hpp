@@ -7,9 +7,12 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Graphics/Viewport.hpp"
+#include "Game/Message.hpp"
 #include "Libraries/imgui.h"
 #include <SFML/Graphics.hpp>
 #include <SFML/Window.hpp>
+#include <vector>
+#include <string>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Zappy
@@ -33,16 +36,9 @@ private:
     unsigned int m_currentY;
     bool m_debug;
 
-    bool m_EggLogs = true;
-    bool m_BroadcastLogs = true;
-    bool m_EventLogs = false;
-    bool m_IncantationLogs = true;
-    bool m_ResourceLogs = true;
-    bool m_DeathLogs = false;
-    bool m_VictoryLogs = true;
-    bool m_InfoLogs = false;
-    bool m_ErrorLogs = false;
-
+    unsigned int m_logFilter;   //<! Bitmask of the message types shown
+    std::vector<const Message*> m_logRows; //<! Messages passing the filter
+    std::string m_logText;      //<! Text of the row being drawn
 
 public:
     ///////////////////////////////////////////////////////////////////////////
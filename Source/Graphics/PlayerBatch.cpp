@@ -0,0 +1,138 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Graphics/PlayerBatch.hpp"
+#include <cmath>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+namespace Zappy
+{
+
+///////////////////////////////////////////////////////////////////////////////
+PlayerBatch::PlayerBatch(float tileSize)
+    : m_tileSize(tileSize)
+    , m_vertices(sf::Triangles)
+{
+    static constexpr float PI = 3.141592654f;
+    float radius = tileSize / 4.f;
+
+    // The triangle pointing north is rotated by a quarter turn for each
+    // orientation
+    const std::array<sf::Vector2f, 3> north = {{
+        {0.f, -2.f * radius}, {-radius, 0.f}, {radius, 0.f}
+    }};
+
+    for (size_t o = 0; o < m_triangles.size(); ++o)
+    {
+        float cosine = std::round(std::cos(o * PI / 2.f));
+        float sine = std::round(std::sin(o * PI / 2.f));
+
+        for (size_t i = 0; i < north.size(); ++i)
+        {
+            m_triangles[o][i] = sf::Vector2f(
+                north[i].x * cosine - north[i].y * sine,
+                north[i].x * sine + north[i].y * cosine
+            );
+        }
+    }
+    for (size_t i = 0; i < m_circle.size(); ++i)
+    {
+        float angle = static_cast<float>(i) * 2.f * PI / CIRCLE_POINTS;
+
+        m_circle[i] = sf::Vector2f(
+            radius * std::cos(angle), radius * std::sin(angle)
+        );
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void PlayerBatch::Build(
+    const Snapshot& snapshot,
+    unsigned int left,
+    unsigned int top,
+    unsigned int right,
+    unsigned int bottom
+)
+{
+    float offset = m_tileSize / 2.f - 1.5f;
+
+    m_teamColors.clear();
+    for (size_t team = 0; team < snapshot.GetTeamCount(); ++team)
+    {
+        m_teamColors.push_back(snapshot.GetTeam(team).GetColor());
+    }
+    m_vertices.clear();
+
+    for (unsigned int y = top; y < bottom; ++y)
+    {
+        for (unsigned int x = left; x < right; ++x)
+        {
+            sf::Vector2f position(
+                static_cast<float>(x) * m_tileSize + offset,
+                static_cast<float>(y) * m_tileSize + offset
+            );
+
+            // One bit per orientation already drawn on the tile
+            unsigned int drawn = 0;
+            size_t topTeam = 0;
+            bool occupied = false;
+
+            snapshot.ForEachPlayerAt(x, y,
+                [&](const Player& player, size_t team)
+            {
+                topTeam = team;
+                occupied = true;
+
+                // Orientations run from 1 (north) to 4 (west)
+                unsigned int orientation = (player.GetOrientation() + 3) % 4;
+                unsigned int bit = 1u << orientation;
+
+                if (drawn & bit)
+                {
+                    return;
+                }
+
+                Append(
+                    m_triangles[orientation].data(),
+                    m_triangles[orientation].size(),
+                    position, m_teamColors[team]
+                );
+                drawn |= bit;
+            });
+
+            if (occupied)
+            {
+                Append(
+                    m_circle.data(), m_circle.size(),
+                    position, m_teamColors[topTeam]
+                );
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const sf::VertexArray& PlayerBatch::GetVertices(void) const
+{
+    return (m_vertices);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void PlayerBatch::Append(
+    const sf::Vector2f* points,
+    size_t count,
+    const sf::Vector2f& position,
+    const sf::Color& color
+)
+{
+    for (size_t i = 1; i + 1 < count; ++i)
+    {
+        m_vertices.append(sf::Vertex(position + points[0], color));
+        m_vertices.append(sf::Vertex(position + points[i], color));
+        m_vertices.append(sf::Vertex(position + points[i + 1], color));
+    }
+}
+
+} // !namespace Zappy
@@ -0,0 +1,102 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Game/Snapshot.hpp"
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+namespace Zappy
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Batches the player markers of the visible tiles
+///
+/// A tile shows one triangle per orientation taken by its players and a
+/// circle in the color of its last player. The markers are translated
+/// copies of shapes built once, generated into a single vertex array drawn
+/// in one call. The buffers keep their capacity, so a frame showing no
+/// more players than the previous ones does not allocate.
+///
+///////////////////////////////////////////////////////////////////////////////
+class PlayerBatch
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Constants
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t CIRCLE_POINTS = 12;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private members
+    ///////////////////////////////////////////////////////////////////////////
+    float m_tileSize;               //< The side of a tile in pixels
+    std::array<std::array<sf::Vector2f, 3>, 4> m_triangles; //< By orientation
+    std::array<sf::Vector2f, CIRCLE_POINTS> m_circle; //< The top player mark
+    std::vector<sf::Color> m_teamColors; //< The colors of the drawn teams
+    sf::VertexArray m_vertices;     //< The markers built by the last frame
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor of an empty batch
+    ///
+    /// \param tileSize The side of a tile in pixels
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit PlayerBatch(float tileSize);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Generate the markers of the players standing in an area
+    ///
+    /// \param snapshot The state to draw
+    /// \param left The first column of the area
+    /// \param top The first row of the area
+    /// \param right One past the last column of the area
+    /// \param bottom One past the last row of the area
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Build(
+        const Snapshot& snapshot,
+        unsigned int left,
+        unsigned int top,
+        unsigned int right,
+        unsigned int bottom
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the markers generated by Build
+    ///
+    /// \return The vertex array of the markers, as triangles
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const sf::VertexArray& GetVertices(void) const;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Append a filled polygon to the markers
+    ///
+    /// \param points The points of the polygon relative to its position
+    /// \param count The number of points, the polygon being convex
+    /// \param position The position of the polygon
+    /// \param color The fill color
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Append(
+        const sf::Vector2f* points,
+        size_t count,
+        const sf::Vector2f& position,
+        const sf::Color& color
+    );
+};
+
+} // !namespace Zappy
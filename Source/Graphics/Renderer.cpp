@@ -32,12 +32,15 @@ bool Renderer::IsOpen(void) const
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Renderer::Update(void)
+bool Renderer::Update(void)
 {
     sf::Event event;
+    bool processed = false;
 
     while (m_window.pollEvent(event))
     {
+        processed = true;
+
         m_gui.ProcessEvent(event);
         m_viewport.ProcessEvent(event);
 
@@ -54,18 +57,29 @@ void Renderer::Update(void)
         }
     }
 
-    m_gui.Update();
+    return (processed);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Renderer::Display(void)
+void Renderer::Display(bool stateChanged)
 {
+    m_gui.Update();
+
     m_window.clear();
-    m_viewport.Render();
+    if (stateChanged || m_viewport.NeedsRender())
+    {
+        m_viewport.Render();
+    }
     m_gui.Render(m_viewport);
     m_window.display();
 }
 
+///////////////////////////////////////////////////////////////////////////////
+bool Renderer::NeedsFrame(void) const
+{
+    return (m_viewport.NeedsRender());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void Renderer::Close(void)
 {
@@ -55,16 +55,31 @@ public:
     bool IsOpen(void) const;
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Update the renderer
+    /// \brief Process the pending window events
+    ///
+    /// \return True if at least one event was processed, false otherwise
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void Update(void);
+    bool Update(void);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Display the renderer
     ///
+    /// The viewport texture is only rendered again when needed, otherwise
+    /// the last one is shown as is.
+    ///
+    /// \param stateChanged True if the game state changed since last frame
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Display(bool stateChanged);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Check if the viewport waits for a frame to be drawn
+    ///
+    /// \return True if the view changed or animations are playing
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    void Display(void);
+    bool NeedsFrame(void) const;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Close the renderer
@@ -5,6 +5,7 @@
 #include "Game/GameState.hpp"
 #include "Libraries/imgui.h"
 #include <iostream>
+#include <bit>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Zappy
@@ -23,12 +24,26 @@ Viewport::Viewport(void)
     , m_viewportY(0.f)
     , m_forceRender(false)
     , m_fontLoaded(false)
+    , m_chunkColumns(0)
+    , m_drawCalls(0)
+    , m_lastDrawCalls(0)
     , m_renderWinner(true)
+    , m_grid(sf::Triangles)
+    , m_gridWidth(0)
+    , m_gridHeight(0)
+    , m_selection(sf::Vector2f(
+        TILE_SIZE - OUTLINE_THICKNESS, TILE_SIZE - OUTLINE_THICKNESS
+    ))
+    , m_players(TILE_SIZE)
     , m_indexX(0)
     , m_indexY(0)
 {
     Resize(DEFAULT_WIDTH, DEFAULT_HEIGHT);
 
+    m_selection.setFillColor(sf::Color::Transparent);
+    m_selection.setOutlineThickness(OUTLINE_THICKNESS + 1.0f);
+    m_selection.setOutlineColor(sf::Color(255, 215, 0));
+
     auto appdir = std::getenv("APPDIR");
 
     if (appdir && m_font.loadFromFile(
@@ -36,12 +51,16 @@ Viewport::Viewport(void)
     ))
     {
         m_fontLoaded = true;
-        m_text.setFont(m_font);
     }
     else if (m_font.loadFromFile("Assets/Fonts/Arial.ttf"))
     {
         m_fontLoaded = true;
-        m_text.setFont(m_font);
+    }
+
+    if (m_fontLoaded)
+    {
+        // 12.5% of tile size
+        m_glyphs.Bake(m_font, static_cast<unsigned int>(TILE_SIZE * 0.125f));
     }
 }
 
@@ -67,9 +86,8 @@ bool Viewport::Resize(unsigned int width, unsigned int height)
         height = DEFAULT_HEIGHT;
     }
 
-    GameState& gs = GameState::GetInstance();
-
-    auto [mapWidth, mapHeight] = gs.GetDimensions();
+    auto [mapWidth, mapHeight] = GameState::GetInstance()
+        .GetSnapshot()->GetDimensions();
 
     float gridWidth = mapWidth * TILE_SIZE;
     float gridHeight = mapHeight * TILE_SIZE;
@@ -159,8 +177,8 @@ void Viewport::ProcessEvent(const sf::Event& event)
                 unsigned int tileX = static_cast<unsigned int>(worldPos.x / TILE_SIZE);
                 unsigned int tileY = static_cast<unsigned int>(worldPos.y / TILE_SIZE);
 
-                GameState& gs = GameState::GetInstance();
-                auto [mapWidth, mapHeight] = gs.GetDimensions();
+                auto [mapWidth, mapHeight] = GameState::GetInstance()
+                    .GetSnapshot()->GetDimensions();
 
                 if (tileX < static_cast<unsigned int>(mapWidth) &&
                     tileY < static_cast<unsigned int>(mapHeight)) {
@@ -188,23 +206,7 @@ void Viewport::ProcessEvent(const sf::Event& event)
             sf::Vector2f delta = m_lastMousePos - newMousePos;
 
             m_view.move(delta * m_zoom);
-
-            GameState& gs = GameState::GetInstance();
-            auto [mapWidth, mapHeight] = gs.GetDimensions();
-            sf::Vector2f viewCenter = m_view.getCenter();
-
-            float gridWidth = mapWidth * TILE_SIZE;
-            float gridHeight = mapHeight * TILE_SIZE;
-
-            float minX = -gridWidth * 0.5f;
-            float maxX = gridWidth * 1.5f;
-            float minY = -gridHeight * 0.5f;
-            float maxY = gridHeight * 1.5f;
-
-            viewCenter.x = std::clamp(viewCenter.x, minX, maxX);
-            viewCenter.y = std::clamp(viewCenter.y, minY, maxY);
-
-            m_view.setCenter(viewCenter);
+            ClampView();
             m_texture.setView(m_view);
 
             m_lastMousePos = newMousePos;
@@ -216,6 +218,7 @@ void Viewport::ProcessEvent(const sf::Event& event)
         if (event.key.code == sf::Keyboard::Space)
         {
             m_renderWinner = !m_renderWinner;
+            m_forceRender = true;
         }
     }
 }
@@ -230,8 +233,90 @@ void Viewport::Zoom(float factor)
 
     m_zoom *= factor;
     m_view.zoom(factor);
+    ClampView();
     m_texture.setView(m_view);
-    Render();
+    m_forceRender = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Viewport::ClampView(void)
+{
+    auto [mapWidth, mapHeight] = GameState::GetInstance()
+        .GetSnapshot()->GetDimensions();
+    sf::Vector2f viewCenter = m_view.getCenter();
+
+    float gridWidth = mapWidth * TILE_SIZE;
+    float gridHeight = mapHeight * TILE_SIZE;
+
+    float minX = -gridWidth * 0.5f;
+    float maxX = gridWidth * 1.5f;
+    float minY = -gridHeight * 0.5f;
+    float maxY = gridHeight * 1.5f;
+
+    viewCenter.x = std::clamp(viewCenter.x, minX, maxX);
+    viewCenter.y = std::clamp(viewCenter.y, minY, maxY);
+
+    m_view.setCenter(viewCenter);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+sf::FloatRect Viewport::GetViewBounds(void) const
+{
+    const sf::Vector2f& center = m_view.getCenter();
+    const sf::Vector2f& size = m_view.getSize();
+
+    return (sf::FloatRect(
+        center.x - size.x / 2.f, center.y - size.y / 2.f, size.x, size.y
+    ));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Viewport::TileRect Viewport::GetVisibleTiles(
+    unsigned int width,
+    unsigned int height
+) const
+{
+    sf::FloatRect bounds = GetViewBounds();
+    sf::FloatRect map(
+        0.f, 0.f,
+        static_cast<float>(width) * TILE_SIZE,
+        static_cast<float>(height) * TILE_SIZE
+    );
+    TileRect rect = {0, 0, 0, 0};
+
+    // The margin would otherwise pull the edge of the map into a view that
+    // does not show any of it
+    if (!bounds.intersects(map))
+    {
+        return (rect);
+    }
+
+    auto toTile = [](float position, unsigned int limit)
+    {
+        float tile = position / TILE_SIZE;
+
+        if (tile <= 0.f)
+        {
+            return (0u);
+        }
+        if (tile >= static_cast<float>(limit))
+        {
+            return (limit);
+        }
+        return (static_cast<unsigned int>(tile));
+    };
+
+    rect.left = toTile(bounds.left, width);
+    rect.top = toTile(bounds.top, height);
+    rect.right = toTile(bounds.left + bounds.width, width);
+    rect.bottom = toTile(bounds.top + bounds.height, height);
+
+    // Include the partially visible tile and the margin on each side
+    rect.left -= std::min(rect.left, CULL_MARGIN);
+    rect.top -= std::min(rect.top, CULL_MARGIN);
+    rect.right = std::min(rect.right + 1 + CULL_MARGIN, width);
+    rect.bottom = std::min(rect.bottom + 1 + CULL_MARGIN, height);
+    return (rect);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -241,12 +326,43 @@ void Viewport::SetViewportPosition(float x, float y)
     m_viewportY = y;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+bool Viewport::NeedsRender(void) const
+{
+    return (m_forceRender || IsAnimating());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Viewport::IsAnimating(void) const
+{
+    return (!m_animations.IsEmpty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int Viewport::GetDrawCalls(void) const
+{
+    return (m_lastDrawCalls);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Viewport::Draw(const sf::Drawable& drawable)
+{
+    m_texture.draw(drawable);
+    m_drawCalls++;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void Viewport::Render(void)
 {
     GameState& gs = GameState::GetInstance();
 
+    // Tiles are taken first: they are only handed over once published, so
+    // the snapshot loaded next already holds their new content
+    gs.ConsumeDirtyTiles(m_dirtyTiles);
+    m_snapshot = gs.GetSnapshot();
+
     m_forceRender = false;
+    m_drawCalls = 0;
     m_texture.setView(m_view);
 
     m_texture.clear(sf::Color(20, 20, 20));
@@ -256,158 +372,212 @@ void Viewport::Render(void)
     ProcessAnimationEvents();
     UpdateAndRenderAnimations();
 
-    if (gs.HasWin() && m_renderWinner)
+    if (m_snapshot->HasWin() && m_renderWinner)
     {
-        RenderWinner(gs.GetWinner());
-        m_activeAnimations.clear();
+        RenderWinner(m_snapshot->GetWinner());
+        m_animations.Clear();
     }
 
     m_texture.display();
+
+    m_lastDrawCalls = m_drawCalls;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Viewport::RenderGrid(void)
+void Viewport::BuildGrid(unsigned int width, unsigned int height)
 {
-    GameState& gs = GameState::GetInstance();
-    auto [width, height] = gs.GetDimensions();
+    static const sf::Color OUTLINE_COLOR(80, 80, 80);
 
-    GameState::ScopedLock lock(gs);
+    float right = static_cast<float>(width) * TILE_SIZE;
+    float bottom = static_cast<float>(height) * TILE_SIZE;
 
-    static constexpr float OUTLINE_THICKNESS = 3.f;
-
-    sf::RectangleShape tile(sf::Vector2f(
-        TILE_SIZE - OUTLINE_THICKNESS, TILE_SIZE - OUTLINE_THICKNESS
-    ));
+    auto appendBand = [this](float left, float top, float w, float h)
+    {
+        sf::Vector2f a(left, top);
+        sf::Vector2f b(left + w, top);
+        sf::Vector2f c(left + w, top + h);
+        sf::Vector2f d(left, top + h);
+
+        m_grid.append(sf::Vertex(a, OUTLINE_COLOR));
+        m_grid.append(sf::Vertex(b, OUTLINE_COLOR));
+        m_grid.append(sf::Vertex(c, OUTLINE_COLOR));
+        m_grid.append(sf::Vertex(a, OUTLINE_COLOR));
+        m_grid.append(sf::Vertex(c, OUTLINE_COLOR));
+        m_grid.append(sf::Vertex(d, OUTLINE_COLOR));
+    };
+
+    m_grid.clear();
+    m_gridWidth = width;
+    m_gridHeight = height;
 
-    tile.setFillColor(sf::Color::Transparent);
-    tile.setOutlineThickness(OUTLINE_THICKNESS);
-    tile.setOutlineColor(sf::Color(80, 80, 80));
+    if (width == 0 || height == 0)
+    {
+        return;
+    }
 
-    for (unsigned int y = 0; y < height; ++y)
+    // Each band covers the outline drawn outside of one tile edge and inside
+    // of the facing edge of its neighbour
+    for (unsigned int x = 0; x <= width; ++x)
     {
-        for (unsigned int x = 0; x < width; ++x)
-        {
-            float posX = static_cast<float>(x) * TILE_SIZE;
-            float posY = static_cast<float>(y) * TILE_SIZE;
+        appendBand(
+            static_cast<float>(x) * TILE_SIZE - OUTLINE_THICKNESS,
+            -OUTLINE_THICKNESS,
+            OUTLINE_THICKNESS,
+            bottom + OUTLINE_THICKNESS
+        );
+    }
+    for (unsigned int y = 0; y <= height; ++y)
+    {
+        appendBand(
+            -OUTLINE_THICKNESS,
+            static_cast<float>(y) * TILE_SIZE - OUTLINE_THICKNESS,
+            right + OUTLINE_THICKNESS,
+            OUTLINE_THICKNESS
+        );
+    }
+}
 
-            tile.setPosition(posX, posY);
-            m_texture.draw(tile);
+///////////////////////////////////////////////////////////////////////////////
+void Viewport::ResetChunks(unsigned int width, unsigned int height)
+{
+    unsigned int rows = (height + CHUNK_SIZE - 1) / CHUNK_SIZE;
 
-            const Inventory& tileInventory = gs.GetTileAt(x, y);
+    m_chunkColumns = (width + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    m_chunks.assign(m_chunkColumns * rows, Chunk{m_glyphs, true});
+}
 
-            if (m_fontLoaded) {
-                float offsetX = TILE_SIZE * 0.03f;  // 3% of tile size
-                float offsetY = TILE_SIZE * 0.03f;  // 3% of tile size
-                float lineSpacing = TILE_SIZE * 0.125f;  // 12.5% of tile size
-                m_text.setCharacterSize(static_cast<unsigned int>(TILE_SIZE * 0.125f));  // 12.5% of tile size
+///////////////////////////////////////////////////////////////////////////////
+void Viewport::UpdateDirtyChunks(unsigned int width, unsigned int height)
+{
+    size_t tiles = static_cast<size_t>(width) * height;
 
-                auto& resources = GetResources(tileInventory);
+    for (size_t word = 0; word < m_dirtyTiles.size(); ++word)
+    {
+        std::uint64_t bits = m_dirtyTiles[word];
 
-                float yPos = posY + offsetY;
-                for (const auto& res : resources)
-                {
-                    m_text.setFillColor(res.color);
-                    m_text.setString(std::to_string(res.value));
-                    m_text.setPosition(posX + offsetX, yPos);
-                    m_texture.draw(m_text);
-                    yPos += lineSpacing;
-                }
+        while (bits != 0)
+        {
+            size_t tile = word * 64 + std::countr_zero(bits);
+
+            bits &= bits - 1;
+            if (tile >= tiles)
+            {
+                return;
             }
+
+            unsigned int x = static_cast<unsigned int>(tile % width);
+            unsigned int y = static_cast<unsigned int>(tile / width);
+
+            m_chunks[
+                (y / CHUNK_SIZE) * m_chunkColumns + x / CHUNK_SIZE
+            ].dirty = true;
         }
     }
-    tile.setPosition(static_cast<float>(m_indexX) * TILE_SIZE, static_cast<float>(m_indexY) * TILE_SIZE);
-    tile.setOutlineColor(sf::Color(255, 215, 0));
-    tile.setOutlineThickness(OUTLINE_THICKNESS + 1.0f);
-    m_texture.draw(tile);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Viewport::RenderPlayers(void)
+void Viewport::BuildChunk(
+    unsigned int column,
+    unsigned int row,
+    unsigned int width,
+    unsigned int height
+)
 {
-    GameState& gs = GameState::GetInstance();
+    Chunk& chunk = m_chunks[row * m_chunkColumns + column];
 
-    GameState::ScopedLock lock(gs);
+    unsigned int left = column * CHUNK_SIZE;
+    unsigned int top = row * CHUNK_SIZE;
+    unsigned int right = std::min(left + CHUNK_SIZE, width);
+    unsigned int bottom = std::min(top + CHUNK_SIZE, height);
 
-    auto [width, height] = gs.GetDimensions();
-    auto teams = gs.GetTeams();
-    std::map<std::string, sf::Color> teamColors;
+    float offsetX = TILE_SIZE * 0.03f;  // 3% of tile size
+    float offsetY = TILE_SIZE * 0.03f;  // 3% of tile size
+    float lineSpacing = TILE_SIZE * 0.125f;  // 12.5% of tile size
 
-    for (const auto& team : teams)
+    chunk.counters.Clear();
+    chunk.dirty = false;
+
+    if (!m_fontLoaded)
     {
-        teamColors[team.GetName()] = team.GetColor();
+        return;
     }
 
-    static constexpr float CIRCLE_RADIUS = TILE_SIZE / 4.f;
+    for (unsigned int y = top; y < bottom; ++y)
+    {
+        for (unsigned int x = left; x < right; ++x)
+        {
+            float posX = static_cast<float>(x) * TILE_SIZE;
+            float posY = static_cast<float>(y) * TILE_SIZE;
 
-    sf::CircleShape circle = sf::CircleShape(CIRCLE_RADIUS);
-    sf::ConvexShape triangle(3);
+            auto& resources = GetResources(m_snapshot->GetTileAt(x, y));
 
-    circle.setOrigin(CIRCLE_RADIUS, CIRCLE_RADIUS);
-    circle.setOutlineThickness(0.f);
+            float yPos = posY + offsetY;
+            for (const auto& res : resources)
+            {
+                chunk.counters.Append(res.value, posX + offsetX, yPos, res.color);
+                yPos += lineSpacing;
+            }
+        }
+    }
+}
 
-    triangle.setPoint(0, sf::Vector2f(0.f, -CIRCLE_RADIUS));
-    triangle.setPoint(1, sf::Vector2f(-CIRCLE_RADIUS, CIRCLE_RADIUS));
-    triangle.setPoint(2, sf::Vector2f(CIRCLE_RADIUS, CIRCLE_RADIUS));
-    triangle.setOrigin(0.f, CIRCLE_RADIUS);
+///////////////////////////////////////////////////////////////////////////////
+void Viewport::RenderGrid(void)
+{
+    auto [width, height] = m_snapshot->GetDimensions();
 
-    float offset = TILE_SIZE / 2.f - 1.5f;
+    if (width != m_gridWidth || height != m_gridHeight)
+    {
+        BuildGrid(width, height);
+        ResetChunks(width, height);
+    }
+    Draw(m_grid);
 
-    std::vector<unsigned int> dirs;
+    UpdateDirtyChunks(width, height);
 
-    for (unsigned int y = 0; y < height; ++y)
+    // Only the visible chunks are rebuilt, the others stay dirty until shown
+    TileRect visible = GetVisibleTiles(width, height);
+
+    for (unsigned int row = visible.top / CHUNK_SIZE;
+        visible.left < visible.right && row * CHUNK_SIZE < visible.bottom;
+        ++row)
     {
-        for (unsigned int x = 0; x < width; ++x)
+        for (unsigned int column = visible.left / CHUNK_SIZE;
+            column * CHUNK_SIZE < visible.right; ++column)
         {
-            float posX = static_cast<float>(x) * TILE_SIZE + offset;
-            float posY = static_cast<float>(y) * TILE_SIZE + offset;
-
-            auto players = gs.GetPlayersAt(x, y);
+            Chunk& chunk = m_chunks[row * m_chunkColumns + column];
 
-            if (players.empty())
+            if (chunk.dirty)
             {
-                continue;
+                BuildChunk(column, row, width, height);
             }
-
-            dirs.clear();
-
-            for (const auto player : players)
+            if (m_fontLoaded)
             {
-                if (dirs.size() == 4)
-                {
-                    break;
-                }
-
-                if (!player)
-                {
-                    continue;
-                }
-
-                unsigned int orientation = player->GetOrientation();
-
-                auto it = std::find(dirs.begin(), dirs.end(), orientation);
-                if (it == dirs.end())
-                {
-                    triangle.setFillColor(teamColors[player->GetTeam()]);
-                    triangle.setPosition(posX, posY);
-                    triangle.setRotation(
-                        90.f * (static_cast<float>(orientation) - 1.f)
-                    );
-                    m_texture.draw(triangle);
-                    dirs.push_back(orientation);
-                }
+                chunk.counters.Render(m_texture);
+                m_drawCalls++;
             }
+        }
+    }
 
-            const auto top = players.back();
+    m_selection.setPosition(
+        static_cast<float>(m_indexX) * TILE_SIZE,
+        static_cast<float>(m_indexY) * TILE_SIZE
+    );
+    Draw(m_selection);
+}
 
-            if (!top)
-            {
-                continue;
-            }
+///////////////////////////////////////////////////////////////////////////////
+void Viewport::RenderPlayers(void)
+{
+    auto [width, height] = m_snapshot->GetDimensions();
+    TileRect visible = GetVisibleTiles(width, height);
 
-            circle.setPosition(posX, posY);
-            circle.setFillColor(teamColors[top->GetTeam()]);
-            m_texture.draw(circle);
-        }
+    m_players.Build(
+        *m_snapshot, visible.left, visible.top, visible.right, visible.bottom
+    );
+    if (m_players.GetVertices().getVertexCount() > 0)
+    {
+        Draw(m_players.GetVertices());
     }
 }
 
@@ -430,8 +600,7 @@ std::vector<Viewport::ResourceDisplay>& Viewport::GetResources(const Inventory&
 ///////////////////////////////////////////////////////////////////////////////
 void Viewport::RenderWinner(const Team& team)
 {
-    GameState& gs = GameState::GetInstance();
-    auto [mapWidth, mapHeight] = gs.GetDimensions();
+    auto [mapWidth, mapHeight] = m_snapshot->GetDimensions();
     sf::Vector2u size = m_texture.getSize();
 
     float gridCenterX = static_cast<float>(mapWidth * TILE_SIZE) / 2.0f;
@@ -450,7 +619,7 @@ void Viewport::RenderWinner(const Team& team)
     background.setPosition(gridCenterX, gridCenterY);
     background.setOutlineThickness(4.0f);
     background.setOutlineColor(team.GetColor());
-    m_texture.draw(background);
+    Draw(background);
 
     sf::Text text;
     if (m_fontLoaded) {
@@ -458,11 +627,11 @@ void Viewport::RenderWinner(const Team& team)
         text.setString("WINNER: " + team.GetName());
         text.setCharacterSize(42);
         text.setFillColor((team.GetColor()));
-        m_text.setStyle(sf::Text::Bold);
+        text.setStyle(sf::Text::Bold);
         text.setPosition(gridCenterX, gridCenterY);
         sf::FloatRect textBounds = text.getLocalBounds();
         text.setOrigin(textBounds.width / 2.0f, textBounds.height / 2.0f);
-        m_texture.draw(text);
+        Draw(text);
     }
     m_texture.setView(originalView);
 }
@@ -471,42 +640,48 @@ void Viewport::RenderWinner(const Team& team)
 void Viewport::ProcessAnimationEvents(void)
 {
     GameState& gs = GameState::GetInstance();
-
-    GameState::ScopedLock lock(gs);
-
+    unsigned int width = m_snapshot->GetWidth();
 
     while (const auto& event = gs.PopAnimation())
     {
-        Animation animation(
-            event->x * TILE_SIZE + (TILE_SIZE/2),
-            event->y * TILE_SIZE + (TILE_SIZE/2),
-            TILE_SIZE * 1.5625f, event->duration
-        );
+        float x = event->x * TILE_SIZE + (TILE_SIZE/2);
+        float y = event->y * TILE_SIZE + (TILE_SIZE/2);
+        std::uint32_t tile = event->y * width + event->x;
 
+        // Broadcasts merge by team, incantations by outcome
         switch (event->type)
         {
             case GameState::AnimationType::Broadcast:
-                animation.SetCircle();
-                animation.SetColor(event->team.GetColor());
-                m_activeAnimations.push_back(animation);
+                m_animations.Spawn(
+                    AnimationPool::Shape::Ring, tile,
+                    static_cast<std::uint32_t>(event->team), x, y,
+                    ANIMATION_RADIUS, event->duration, event->color,
+                    event->intensity
+                );
                 break;
 
             case GameState::AnimationType::IncantationStart:
-                animation.SetRectangle();
-                animation.SetColor(sf::Color::Yellow);
-                m_activeAnimations.push_back(animation);
+                m_animations.Spawn(
+                    AnimationPool::Shape::Square, tile,
+                    static_cast<std::uint32_t>(event->type), x, y,
+                    ANIMATION_RADIUS, event->duration, sf::Color::Yellow
+                );
                 break;
 
             case GameState::AnimationType::IncantationSuccess:
-                animation.SetRectangle();
-                animation.SetColor(sf::Color::Green);
-                m_activeAnimations.push_back(animation);
+                m_animations.Spawn(
+                    AnimationPool::Shape::Square, tile,
+                    static_cast<std::uint32_t>(event->type), x, y,
+                    ANIMATION_RADIUS, event->duration, sf::Color::Green
+                );
                 break;
 
             case GameState::AnimationType::IncantationFail:
-                animation.SetRectangle();
-                animation.SetColor(sf::Color::Red);
-                m_activeAnimations.push_back(animation);
+                m_animations.Spawn(
+                    AnimationPool::Shape::Square, tile,
+                    static_cast<std::uint32_t>(event->type), x, y,
+                    ANIMATION_RADIUS, event->duration, sf::Color::Red
+                );
                 break;
         }
     }
@@ -515,21 +690,21 @@ void Viewport::ProcessAnimationEvents(void)
 ///////////////////////////////////////////////////////////////////////////////
 void Viewport::UpdateAndRenderAnimations(void)
 {
-    auto it = m_activeAnimations.begin();
-    while (it != m_activeAnimations.end())
+    sf::FloatRect bounds = GetViewBounds();
+    float margin = ANIMATION_RADIUS + AnimationPool::MAX_OUTLINE_THICKNESS;
+
+    // Animations centered outside of this area cannot reach the view, even
+    // with the outline drawn past their radius
+    bounds.left -= margin;
+    bounds.top -= margin;
+    bounds.width += 2.f * margin;
+    bounds.height += 2.f * margin;
+
+    m_animations.Update(ImGui::GetIO().DeltaTime);
+    m_animations.Build(bounds);
+    if (m_animations.Render(m_texture))
     {
-        float deltaTime = ImGui::GetIO().DeltaTime;
-        it->Update(deltaTime);
-
-        if (it->IsFinished())
-        {
-            it = m_activeAnimations.erase(it);
-        }
-        else
-        {
-            it->Render(m_texture);
-            ++it;
-        }
+        m_drawCalls++;
     }
 }
 
@@ -7,12 +7,18 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Game/Inventory.hpp"
-#include "Graphics/Animations/Animation.hpp"
+#include "Graphics/Animations/AnimationPool.hpp"
 #include "Game/Team.hpp"
+#include "Game/Snapshot.hpp"
+#include "Graphics/GlyphBatch.hpp"
+#include "Graphics/PlayerBatch.hpp"
 #include <SFML/Graphics.hpp>
 #include <SFML/Window.hpp>
 #include <SFML/System.hpp>
 #include <vector>
+#include <array>
+#include <cstdint>
+#include <memory>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Zappy
@@ -38,6 +44,29 @@ public:
         char symbol;
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Structure to represent a rectangle of tiles
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct TileRect
+    {
+        unsigned int left;      //< The first column of the rectangle
+        unsigned int top;       //< The first row of the rectangle
+        unsigned int right;     //< One past the last column of the rectangle
+        unsigned int bottom;    //< One past the last row of the rectangle
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Structure to represent the cached geometry of a map chunk
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Chunk
+    {
+        GlyphBatch counters;    //< The resource counters of the chunk tiles
+        bool dirty;             //< True if a tile changed since the last build
+    };
+
 private:
     ///////////////////////////////////////////////////////////////////////////
     // Constants
@@ -48,6 +77,10 @@ private:
     static constexpr float MIN_ZOOM = 0.1f;
     static constexpr float MAX_ZOOM = 1.2f;
     static constexpr float TILE_SIZE = 128.0f;
+    static constexpr float OUTLINE_THICKNESS = 3.f;
+    static constexpr float ANIMATION_RADIUS = TILE_SIZE * 1.5625f;
+    static constexpr unsigned int CULL_MARGIN = 1;
+    static constexpr unsigned int CHUNK_SIZE = 32;
 
 private:
     ///////////////////////////////////////////////////////////////////////////
@@ -63,9 +96,20 @@ private:
     bool m_forceRender;             //< Flag to force rendering
     sf::Font m_font;                //< The font used for rendering text
     bool m_fontLoaded;              //< Flag to check if the font is loaded
-    sf::Text m_text;                //< The text object for rendering resources
-    std::vector<Animation> m_activeAnimations;
+    GlyphBatch m_glyphs;            //< The baked digits copied in each chunk
+    std::vector<Chunk> m_chunks;    //< The cached geometry of every chunk
+    unsigned int m_chunkColumns;    //< The number of chunks per row
+    std::vector<std::uint64_t> m_dirtyTiles; //< The tiles taken from GameState
+    std::shared_ptr<const Snapshot> m_snapshot; //< The state drawn by the frame
+    unsigned int m_drawCalls;       //< Draw calls issued by the current frame
+    unsigned int m_lastDrawCalls;   //< Draw calls issued by the last frame
+    AnimationPool m_animations;     //< The animations running over the map
     bool m_renderWinner;
+    sf::VertexArray m_grid;         //< The tile outlines of the whole map
+    unsigned int m_gridWidth;       //< The map width the grid was built for
+    unsigned int m_gridHeight;      //< The map height the grid was built for
+    sf::RectangleShape m_selection; //< The outline of the selected tile
+    PlayerBatch m_players;          //< The player markers of the visible tiles
 
 public:
     unsigned int m_indexX;          //< The X index of the viewport
@@ -94,6 +138,25 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     void Render(void);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Check if the last rendered texture is out of date
+    ///
+    /// This does not account for game state changes, which the caller
+    /// tracks through GameState::ConsumeChanged.
+    ///
+    /// \return True if the view changed or animations are playing
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool NeedsRender(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Check if animations are playing
+    ///
+    /// \return True if at least one animation is active, false otherwise
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool IsAnimating(void) const;
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Resize the viewport
     ///
@@ -130,6 +193,14 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     void SetViewportPosition(float x, float y);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the number of draw calls issued by the last frame
+    ///
+    /// \return The draw call count of the last rendered frame
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    unsigned int GetDrawCalls(void) const;
+
 private:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Zoom the viewport
@@ -139,6 +210,88 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     void Zoom(float factor);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Keep the view center within half a map of the map edges
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void ClampView(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the area of the world shown by the view
+    ///
+    /// \return The world rectangle covered by m_view
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    sf::FloatRect GetViewBounds(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the tiles shown by the view, plus CULL_MARGIN on each side
+    ///
+    /// The rectangle is clamped to the map, and all zero when the view
+    /// does not overlap the map at all.
+    ///
+    /// \param width The width of the map in tiles
+    /// \param height The height of the map in tiles
+    ///
+    /// \return The rectangle of tiles to render
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    TileRect GetVisibleTiles(unsigned int width, unsigned int height) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Draw on the viewport texture and count the draw call
+    ///
+    /// \param drawable The object to draw
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Draw(const sf::Drawable& drawable);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Build the tile outlines of the whole map into m_grid
+    ///
+    /// Adjacent tiles share their outlines, so the grid is made of one band
+    /// per row and column boundary instead of one outline per tile.
+    ///
+    /// \param width The width of the map in tiles
+    /// \param height The height of the map in tiles
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void BuildGrid(unsigned int width, unsigned int height);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Drop every chunk cache and split the map in new chunks
+    ///
+    /// \param width The width of the map in tiles
+    /// \param height The height of the map in tiles
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void ResetChunks(unsigned int width, unsigned int height);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Mark the chunks holding the tiles taken from GameState as dirty
+    ///
+    /// \param width The width of the map in tiles
+    /// \param height The height of the map in tiles
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void UpdateDirtyChunks(unsigned int width, unsigned int height);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Rebuild the cached geometry of a chunk from its tiles
+    ///
+    /// \param column The column of the chunk
+    /// \param row The row of the chunk
+    /// \param width The width of the map in tiles
+    /// \param height The height of the map in tiles
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void BuildChunk(
+        unsigned int column,
+        unsigned int row,
+        unsigned int width,
+        unsigned int height
+    );
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Render the grid on the viewport
     ///
@@ -148,6 +301,9 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Render the players on the viewport
     ///
+    /// The markers of every visible tile are generated into a single vertex
+    /// array, drawn in one call.
+    ///
     ///////////////////////////////////////////////////////////////////////////
     void RenderPlayers(void);
 
@@ -174,7 +330,7 @@ private:
     void ProcessAnimationEvents(void);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Update and render active animations
+    /// \brief Update active animations and draw them in a single call
     ///
     ///////////////////////////////////////////////////////////////////////////
     void UpdateAndRenderAnimations(void);
@@ -3,26 +3,34 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "Utils/Args.hpp"
 #include "Core/Application.hpp"
+#include "Game/PathHistory.hpp"
 #include "Errors/Exception.hpp"
 #include <string>
 #include <iostream>
+#include <algorithm>
 
 ///////////////////////////////////////////////////////////////////////////////
 int main(int argc, char* argv[])
 {
     std::string host = "localhost";
     int port = 4242;
+    int trail = static_cast<int>(Zappy::PathHistory::DEFAULT_CAPACITY);
 
     Zappy::Args& args = Zappy::Args::GetInstance();
 
     args.AddFlags("port", "Server port number", port, true);
     args.AddFlags("host", "Server host address", host, false);
+    args.AddFlags("trail", "Recent positions kept per player", trail, false);
 
     if (!args.Process(argc, argv))
     {
         return (args.GetExitCode());
     }
 
+    Zappy::PathHistory::SetDefaultCapacity(
+        static_cast<size_t>(std::max(trail, 1))
+    );
+
     if (host == "localhost")
     {
         host = "127.0.0.1";
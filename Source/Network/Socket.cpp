@@ -7,6 +7,8 @@
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <unistd.h>
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18,23 +20,45 @@ namespace Zappy
 ///////////////////////////////////////////////////////////////////////////////
 Socket::Socket(void)
     : m_fd(-1)
+    , m_head(0)
+    , m_tail(0)
+    , m_scan(0)
+    , m_bytes(0)
+    , m_lines(0)
+    , m_bytesPerSecond(0.0)
+    , m_linesPerSecond(0.0)
+    , m_rateUpdate(0)
+    , m_windowStart(Clock::now())
+    , m_windowBytes(0)
+    , m_windowLines(0)
 {}
 
 ///////////////////////////////////////////////////////////////////////////////
 Socket::Socket(int domain, int type, int protocol)
-    : m_fd(socket(domain, type, protocol))
+    : Socket()
 {
+    m_fd = socket(domain, type, protocol);
+
     if (m_fd < 0)
     {
         throw NetworkException("Failed to create socket");
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+Socket::Socket(int fd)
+    : Socket()
+{
+    m_fd = fd;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 Socket::Socket(Socket&& other) noexcept
-    : m_fd(other.m_fd)
+    : Socket()
 {
+    m_fd = other.m_fd;
     other.m_fd = -1;
+    MoveBuffer(other);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -51,6 +75,7 @@ Socket& Socket::operator=(Socket&& other) noexcept
         Close();
         m_fd = other.m_fd;
         other.m_fd = -1;
+        MoveBuffer(other);
     }
     return (*this);
 }
@@ -162,30 +187,37 @@ std::string Socket::Recv(size_t size, int flags)
 ///////////////////////////////////////////////////////////////////////////////
 std::string Socket::RecvLine(int flags)
 {
-    if (!IsValid())
+    std::string_view line;
+
+    while (!PopLine(line))
     {
-        return ("");
+        if (Fill(flags) <= 0)
+        {
+            return ("");
+        }
     }
 
-    std::string line;
-    char ch;
-    ssize_t received;
+    return (std::string(line));
+}
 
-    while ((received = ::recv(m_fd, &ch, 1, flags)) > 0)
+///////////////////////////////////////////////////////////////////////////////
+ssize_t Socket::Fill(int flags)
+{
+    if (!IsValid())
     {
-        if (ch == '\n')
-        {
-            break;
-        }
-        if (ch != '\r')  // Skip carriage return characters
-        {
-            line += ch;
-        }
+        return (-1);
     }
 
+    Compact();
+
+    ssize_t received = ::recv(
+        m_fd, m_buffer.data() + m_tail, m_buffer.size() - m_tail, flags
+    );
+
     if (received == 0)
     {
         Close();
+        return (0);
     }
     else if (received < 0)
     {
@@ -193,9 +225,140 @@ std::string Socket::RecvLine(int flags)
         {
             Close();
         }
+        return (-1);
+    }
+
+    m_tail += static_cast<size_t>(received);
+    m_bytes.fetch_add(static_cast<std::uint64_t>(received),
+        std::memory_order_relaxed);
+    UpdateRates();
+
+    return (received);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Socket::PopLine(std::string_view& line)
+{
+    if (m_scan >= m_tail)
+    {
+        return (false);
+    }
+
+    const char* data = m_buffer.data();
+    const char* eol = static_cast<const char*>(
+        std::memchr(data + m_scan, '\n', m_tail - m_scan)
+    );
+
+    if (!eol)
+    {
+        m_scan = m_tail;
+        return (false);
+    }
+
+    size_t end = static_cast<size_t>(eol - data);
+    size_t length = end - m_head;
+
+    if (length > 0 && data[end - 1] == '\r')
+    {
+        length--;
+    }
+
+    line = std::string_view(data + m_head, length);
+    m_head = end + 1;
+    m_scan = m_head;
+    m_lines.fetch_add(1, std::memory_order_relaxed);
+
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Socket::Statistics Socket::GetStatistics(void) const
+{
+    Statistics stats;
+    Clock::rep now = Clock::now().time_since_epoch().count();
+    Clock::rep last = m_rateUpdate.load(std::memory_order_relaxed);
+    bool stale = Clock::duration(now - last) > std::chrono::seconds(2);
+
+    stats.bytes = m_bytes.load(std::memory_order_relaxed);
+    stats.lines = m_lines.load(std::memory_order_relaxed);
+    stats.bytesPerSecond = stale ? 0.0 :
+        m_bytesPerSecond.load(std::memory_order_relaxed);
+    stats.linesPerSecond = stale ? 0.0 :
+        m_linesPerSecond.load(std::memory_order_relaxed);
+
+    return (stats);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Socket::Compact(void)
+{
+    if (m_head > 0)
+    {
+        size_t pending = m_tail - m_head;
+
+        std::memmove(m_buffer.data(), m_buffer.data() + m_head, pending);
+        m_scan -= m_head;
+        m_tail = pending;
+        m_head = 0;
     }
 
-    return (line);
+    // A single line longer than the buffer: grow instead of truncating
+    if (m_buffer.size() - m_tail < RECV_CHUNK_SIZE / 2)
+    {
+        m_buffer.resize(std::max(RECV_CHUNK_SIZE, m_buffer.size() * 2));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Socket::UpdateRates(void)
+{
+    Clock::time_point now = Clock::now();
+    std::chrono::duration<double> elapsed = now - m_windowStart;
+
+    if (elapsed < std::chrono::seconds(1))
+    {
+        return;
+    }
+
+    std::uint64_t bytes = m_bytes.load(std::memory_order_relaxed);
+    std::uint64_t lines = m_lines.load(std::memory_order_relaxed);
+
+    m_bytesPerSecond.store(
+        static_cast<double>(bytes - m_windowBytes) / elapsed.count(),
+        std::memory_order_relaxed
+    );
+    m_linesPerSecond.store(
+        static_cast<double>(lines - m_windowLines) / elapsed.count(),
+        std::memory_order_relaxed
+    );
+    m_rateUpdate.store(now.time_since_epoch().count(),
+        std::memory_order_relaxed);
+
+    m_windowStart = now;
+    m_windowBytes = bytes;
+    m_windowLines = lines;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Socket::MoveBuffer(Socket& other)
+{
+    m_buffer = std::move(other.m_buffer);
+    m_head = other.m_head;
+    m_tail = other.m_tail;
+    m_scan = other.m_scan;
+    m_bytes.store(other.m_bytes.load());
+    m_lines.store(other.m_lines.load());
+    m_bytesPerSecond.store(other.m_bytesPerSecond.load());
+    m_linesPerSecond.store(other.m_linesPerSecond.load());
+    m_rateUpdate.store(other.m_rateUpdate.load());
+    m_windowStart = other.m_windowStart;
+    m_windowBytes = other.m_windowBytes;
+    m_windowLines = other.m_windowLines;
+
+    other.m_buffer.clear();
+    other.m_head = 0;
+    other.m_tail = 0;
+    other.m_scan = 0;
 }
 
 } // !namespace Zappy
@@ -8,6 +8,11 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Zappy
@@ -21,11 +26,47 @@ namespace Zappy
 ///////////////////////////////////////////////////////////////////////////////
 class Socket
 {
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Snapshot of the receive throughput of the socket
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Statistics
+    {
+        std::uint64_t bytes;        //<! Total number of bytes received
+        std::uint64_t lines;        //<! Total number of lines extracted
+        double bytesPerSecond;      //<! Bytes received during the last second
+        double linesPerSecond;      //<! Lines extracted during the last second
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Type alias for the statistics clock
+    ///////////////////////////////////////////////////////////////////////////
+    using Clock = std::chrono::steady_clock;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Constants
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t RECV_CHUNK_SIZE = 64 * 1024;
+
 private:
     ///////////////////////////////////////////////////////////////////////////
     // Private member properties
     ///////////////////////////////////////////////////////////////////////////
-    int m_fd;   //<!
+    int m_fd;                               //<!
+    std::vector<char> m_buffer;             //<! Receive buffer
+    size_t m_head;                          //<! Start of the unread data
+    size_t m_tail;                          //<! End of the unread data
+    size_t m_scan;                          //<! End of the data already searched for a newline
+    std::atomic<std::uint64_t> m_bytes;     //<! Total bytes received
+    std::atomic<std::uint64_t> m_lines;     //<! Total lines extracted
+    std::atomic<double> m_bytesPerSecond;   //<! Bytes/s over the last window
+    std::atomic<double> m_linesPerSecond;   //<! Lines/s over the last window
+    std::atomic<Clock::rep> m_rateUpdate;   //<! Time of the last rate update
+    Clock::time_point m_windowStart;        //<! Start of the current rate window
+    std::uint64_t m_windowBytes;            //<! Bytes received at window start
+    std::uint64_t m_windowLines;            //<! Lines extracted at window start
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -44,6 +85,14 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     explicit Socket(int domain, int type, int protocol = 0);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Take ownership of an already open descriptor
+    ///
+    /// \param fd The descriptor, closed along with the socket
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit Socket(int fd);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -162,12 +211,73 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Receive a line (until newline character) from the socket
     ///
+    /// Lines are served from the receive buffer and the socket is only read
+    /// when no complete line is buffered. With MSG_DONTWAIT, an unfinished
+    /// line is kept in the buffer and an empty string is returned.
+    ///
     /// \param flags Optional flags for recv operation
     ///
     /// \return The received line without the newline character
     ///
     ///////////////////////////////////////////////////////////////////////////
     std::string RecvLine(int flags = 0);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Read one chunk from the socket into the receive buffer
+    ///
+    /// Invalidates the views previously returned by PopLine.
+    ///
+    /// \param flags Optional flags for recv operation
+    ///
+    /// \return Number of bytes received, 0 if the peer closed the
+    /// connection, or -1 on error (including EAGAIN)
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ssize_t Fill(int flags = 0);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Extract the next complete line from the receive buffer
+    ///
+    /// Never touches the socket. The view points into the receive buffer and
+    /// stays valid until the next call to Fill or RecvLine.
+    ///
+    /// \param line Set to the line without its trailing newline
+    ///
+    /// \return True if a complete line was available, false otherwise
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool PopLine(std::string_view& line);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the receive throughput of the socket
+    ///
+    /// Safe to call from any thread.
+    ///
+    /// \return The current receive statistics
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Statistics GetStatistics(void) const;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Make room at the end of the receive buffer
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Compact(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Recompute the per-second rates once a window has elapsed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void UpdateRates(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Take over the receive state of another socket
+    ///
+    /// \param other The socket to move the state from
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void MoveBuffer(Socket& other);
 };
 
 } // !namespace Zappy
@@ -0,0 +1,139 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Network/Tokenizer.hpp"
+#include <charconv>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+namespace Zappy
+{
+
+///////////////////////////////////////////////////////////////////////////////
+Tokenizer::Tokenizer(std::string_view input)
+    : m_input(input)
+    , m_error(Error::None)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Tokenizer::ReadUnsigned(unsigned int& value)
+{
+    std::string_view field;
+
+    return (NextField(field) && ParseNumber(field, value));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Tokenizer::ReadID(unsigned int& value)
+{
+    std::string_view field;
+
+    if (!NextField(field))
+    {
+        return (false);
+    }
+    if (field[0] != '#')
+    {
+        return (Fail(Error::Malformed));
+    }
+    return (ParseNumber(field.substr(1), value));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Tokenizer::ReadWord(std::string_view& word)
+{
+    return (NextField(word));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string_view Tokenizer::ReadRest(void)
+{
+    size_t start = m_input.find_first_not_of(' ');
+    std::string_view rest;
+
+    if (start != std::string_view::npos)
+    {
+        rest = m_input.substr(start);
+    }
+    m_input = std::string_view();
+    return (rest);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Tokenizer::AtEnd(void) const
+{
+    return (m_input.find_first_not_of(' ') == std::string_view::npos);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Tokenizer::HasFailed(void) const
+{
+    return (m_error != Error::None);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Tokenizer::Error Tokenizer::GetError(void) const
+{
+    return (m_error);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Tokenizer::NextField(std::string_view& field)
+{
+    if (HasFailed())
+    {
+        return (false);
+    }
+
+    size_t start = m_input.find_first_not_of(' ');
+
+    if (start == std::string_view::npos)
+    {
+        m_input = std::string_view();
+        return (Fail(Error::Missing));
+    }
+
+    size_t end = m_input.find(' ', start);
+
+    if (end == std::string_view::npos)
+    {
+        end = m_input.size();
+    }
+
+    field = m_input.substr(start, end - start);
+    m_input.remove_prefix(end);
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Tokenizer::ParseNumber(std::string_view field, unsigned int& value)
+{
+    unsigned int parsed = 0;
+    const char* end = field.data() + field.size();
+    auto [ptr, ec] = std::from_chars(field.data(), end, parsed);
+
+    if (ec == std::errc::result_out_of_range)
+    {
+        return (Fail(Error::Overflow));
+    }
+    if (ec != std::errc() || ptr != end)
+    {
+        return (Fail(Error::Malformed));
+    }
+
+    value = parsed;
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Tokenizer::Fail(Error error)
+{
+    if (m_error == Error::None)
+    {
+        m_error = error;
+    }
+    return (false);
+}
+
+} // !namespace Zappy
@@ -0,0 +1,154 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <string_view>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+namespace Zappy
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Splits the arguments of a protocol line into fields in place
+///
+/// Fields are separated by spaces and parsed with std::from_chars, so the
+/// tokenizer never allocates and ignores the locale. The first malformed or
+/// missing field is recorded and makes every following read fail, so a
+/// handler can read all its fields and check HasFailed once, then AtEnd
+/// to reject a line carrying more fields than its command takes.
+///
+///////////////////////////////////////////////////////////////////////////////
+class Tokenizer
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Reason why a field could not be read
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    enum class Error
+    {
+        None,       //<! Every field read so far was valid
+        Missing,    //<! The line ended before the field
+        Malformed,  //<! The field is not of the expected form
+        Overflow    //<! The number does not fit in an unsigned int
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private members
+    ///////////////////////////////////////////////////////////////////////////
+    std::string_view m_input;   //<! The characters left to read
+    Error m_error;              //<! The first error encountered
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor
+    ///
+    /// \param input The arguments of a protocol line
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit Tokenizer(std::string_view input);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Read an unsigned decimal integer
+    ///
+    /// \param value Set to the parsed number on success, untouched otherwise
+    ///
+    /// \return True if the field was read, false otherwise
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool ReadUnsigned(unsigned int& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Read an identifier of the form #n
+    ///
+    /// \param value Set to n on success, untouched otherwise
+    ///
+    /// \return True if the field was read, false otherwise
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool ReadID(unsigned int& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Read a field as raw text
+    ///
+    /// \param word Set to the field on success, untouched otherwise
+    ///
+    /// \return True if the field was read, false otherwise
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool ReadWord(std::string_view& word);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Read everything left on the line, without leading spaces
+    ///
+    /// \return The trailing text, possibly empty
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::string_view ReadRest(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Check if every field has been read
+    ///
+    /// \return True if only spaces are left, false otherwise
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool AtEnd(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Check if a read failed
+    ///
+    /// \return True if a field was missing or malformed, false otherwise
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool HasFailed(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the first error encountered
+    ///
+    /// \return The error, or Error::None
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Error GetError(void) const;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Extract the next space-separated field
+    ///
+    /// \param field Set to the field on success
+    ///
+    /// \return True if a field was extracted, false otherwise
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool NextField(std::string_view& field);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Parse a field made of decimal digits only
+    ///
+    /// \param field The field to parse
+    /// \param value Set to the parsed number on success
+    ///
+    /// \return True if the field was parsed, false otherwise
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool ParseNumber(std::string_view field, unsigned int& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Record an error if none was recorded yet
+    ///
+    /// \param error The error to record
+    ///
+    /// \return Always false
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool Fail(Error error);
+};
+
+} // !namespace Zappy
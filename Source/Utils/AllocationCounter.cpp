@@ -0,0 +1,70 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Utils/AllocationCounter.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+///////////////////////////////////////////////////////////////////////////////
+// Allocation counters
+///////////////////////////////////////////////////////////////////////////////
+namespace
+{
+    thread_local std::uint64_t g_threadAllocations = 0;
+    std::atomic<std::uint64_t> g_totalAllocations(0);
+
+    ///////////////////////////////////////////////////////////////////////////
+    void* CountedAllocate(std::size_t size)
+    {
+        g_threadAllocations++;
+        g_totalAllocations.fetch_add(1, std::memory_order_relaxed);
+        return (std::malloc(size == 0 ? 1 : size));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Global allocation functions (the array and nothrow forms forward here)
+///////////////////////////////////////////////////////////////////////////////
+void* operator new(std::size_t size)
+{
+    void* ptr = CountedAllocate(size);
+
+    if (!ptr)
+    {
+        throw std::bad_alloc();
+    }
+    return (ptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+namespace Zappy
+{
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t AllocationCounter::GetThreadCount(void)
+{
+    return (g_threadAllocations);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t AllocationCounter::GetTotalCount(void)
+{
+    return (g_totalAllocations.load(std::memory_order_relaxed));
+}
+
+} // !namespace Zappy
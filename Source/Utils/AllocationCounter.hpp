@@ -0,0 +1,45 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+namespace Zappy
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Counts heap allocations made through the global operator new
+///
+/// The global allocation functions are replaced in AllocationCounter.cpp.
+/// Comparing two readings of the calling thread's counter gives the number
+/// of allocations made by a piece of code.
+///
+///////////////////////////////////////////////////////////////////////////////
+class AllocationCounter
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the number of allocations made by the calling thread
+    ///
+    /// \return The allocation count of the calling thread
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::uint64_t GetThreadCount(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the number of allocations made by all threads
+    ///
+    /// \return The allocation count of the whole process
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::uint64_t GetTotalCount(void);
+};
+
+} // !namespace Zappy
@@ -0,0 +1,185 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <variant>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+namespace Zappy
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Error wrapper used to build a failed Expected
+///
+/// \tparam E The error type
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename E>
+class Unexpected
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private members
+    ///////////////////////////////////////////////////////////////////////////
+    E m_error;                          //<! The wrapped error
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor from an error
+    ///
+    /// \param error The error to wrap
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit Unexpected(E error);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets the wrapped error
+    ///
+    /// \return The error
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const E& GetError(void) const;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Value or error returned without throwing
+///
+/// Subset of C++23 std::expected, which the project standard lacks.
+///
+/// \tparam T The value type
+/// \tparam E The error type
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename E>
+class Expected
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private members
+    ///////////////////////////////////////////////////////////////////////////
+    std::variant<T, Unexpected<E>> m_storage; //<! The value or the error
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor of a successful result
+    ///
+    /// \param value The value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Expected(T value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor of a failed result
+    ///
+    /// \param error The error
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Expected(Unexpected<E> error);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Checks if the result holds a value
+    ///
+    /// \return True on success, false on error
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool HasValue(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Checks if the result holds a value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit operator bool(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets the value, which must be present
+    ///
+    /// \return A reference to the value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    T& GetValue(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets the error, which must be present
+    ///
+    /// \return The error
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const E& GetError(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Accesses the members of the value, which must be present
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    T* operator->(void);
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Success or error returned without throwing
+///
+/// \tparam E The error type
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename E>
+class Expected<void, E>
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private members
+    ///////////////////////////////////////////////////////////////////////////
+    bool m_hasValue;                    //<! The operation succeeded
+    E m_error;                          //<! The error, if it failed
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor of a successful result
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Expected(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor of a failed result
+    ///
+    /// \param error The error
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Expected(Unexpected<E> error);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Checks if the operation succeeded
+    ///
+    /// \return True on success, false on error
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool HasValue(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Checks if the operation succeeded
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit operator bool(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets the error, which must be present
+    ///
+    /// \return The error
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const E& GetError(void) const;
+};
+
+} // !namespace Zappy
+
+///////////////////////////////////////////////////////////////////////////////
+// Template implementations
+///////////////////////////////////////////////////////////////////////////////
+#include "Utils/Expected.inl"
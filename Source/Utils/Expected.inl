@@ -0,0 +1,112 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Utils/Expected.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+namespace Zappy
+{
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename E>
+Unexpected<E>::Unexpected(E error)
+    : m_error(std::move(error))
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename E>
+const E& Unexpected<E>::GetError(void) const
+{
+    return (m_error);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename E>
+Expected<T, E>::Expected(T value)
+    : m_storage(std::in_place_index<0>, std::move(value))
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename E>
+Expected<T, E>::Expected(Unexpected<E> error)
+    : m_storage(std::in_place_index<1>, std::move(error))
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename E>
+bool Expected<T, E>::HasValue(void) const
+{
+    return (m_storage.index() == 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename E>
+Expected<T, E>::operator bool(void) const
+{
+    return (HasValue());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename E>
+T& Expected<T, E>::GetValue(void)
+{
+    return (*std::get_if<0>(&m_storage));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename E>
+const E& Expected<T, E>::GetError(void) const
+{
+    return (std::get_if<1>(&m_storage)->GetError());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename E>
+T* Expected<T, E>::operator->(void)
+{
+    return (std::get_if<0>(&m_storage));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename E>
+Expected<void, E>::Expected(void)
+    : m_hasValue(true)
+    , m_error()
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename E>
+Expected<void, E>::Expected(Unexpected<E> error)
+    : m_hasValue(false)
+    , m_error(error.GetError())
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename E>
+bool Expected<void, E>::HasValue(void) const
+{
+    return (m_hasValue);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename E>
+Expected<void, E>::operator bool(void) const
+{
+    return (m_hasValue);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename E>
+const E& Expected<void, E>::GetError(void) const
+{
+    return (m_error);
+}
+
+} // !namespace Zappy
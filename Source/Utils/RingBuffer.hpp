@@ -0,0 +1,104 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <cstddef>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+namespace Zappy
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Fixed-capacity buffer overwriting its oldest value when full
+///
+/// Storage grows up to the capacity, then pushing a value replaces the
+/// oldest one in place, so eviction is O(1) and never shifts the others.
+///
+/// \tparam T The stored value type
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class RingBuffer
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private members
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<T> m_values;            //<! Values, rotated by m_head
+    size_t m_capacity;                  //<! Maximum number of values
+    size_t m_head;                      //<! Index of the oldest value
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor of an empty ring buffer
+    ///
+    /// \param capacity The maximum number of values, at least 1
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit RingBuffer(size_t capacity);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Appends a value, evicting the oldest one when full
+    ///
+    /// \param value The value to append
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Push(T value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Removes all values
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Clear(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets the number of stored values
+    ///
+    /// \return The number of values
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t GetSize(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets the maximum number of stored values
+    ///
+    /// \return The capacity
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t GetCapacity(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets a value by age
+    ///
+    /// \param index The index of the value, 0 being the oldest
+    ///
+    /// \return A reference to the value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const T& operator[](size_t index) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets a value by age
+    ///
+    /// \param index The index of the value, 0 being the oldest
+    ///
+    /// \return A reference to the value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    T& operator[](size_t index);
+};
+
+} // !namespace Zappy
+
+///////////////////////////////////////////////////////////////////////////////
+// Template implementations
+///////////////////////////////////////////////////////////////////////////////
+#include "Utils/RingBuffer.inl"
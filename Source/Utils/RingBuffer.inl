@@ -0,0 +1,75 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Utils/RingBuffer.hpp"
+#include <algorithm>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+namespace Zappy
+{
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+RingBuffer<T>::RingBuffer(size_t capacity)
+    : m_capacity(std::max<size_t>(capacity, 1))
+    , m_head(0)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void RingBuffer<T>::Push(T value)
+{
+    if (m_values.size() < m_capacity)
+    {
+        m_values.push_back(std::move(value));
+        return;
+    }
+    m_values[m_head] = std::move(value);
+    m_head = (m_head + 1) % m_capacity;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void RingBuffer<T>::Clear(void)
+{
+    m_values.clear();
+    m_head = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+size_t RingBuffer<T>::GetSize(void) const
+{
+    return (m_values.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+size_t RingBuffer<T>::GetCapacity(void) const
+{
+    return (m_capacity);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+const T& RingBuffer<T>::operator[](size_t index) const
+{
+    return (m_values[(m_head + index) % m_values.size()]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+T& RingBuffer<T>::operator[](size_t index)
+{
+    return (m_values[(m_head + index) % m_values.size()]);
+}
+
+} // !namespace Zappy
@@ -0,0 +1,180 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+namespace Zappy
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Dense container addressed by stable, generation-checked handles
+///
+/// Values are stored contiguously so iteration is a linear walk. Removing a
+/// value moves the last one into its place, so insertion and removal are
+/// O(1) but the iteration order is not preserved. A handle stays valid until
+/// its value is removed; after that, the generation of its slot no longer
+/// matches and lookups through it fail instead of aliasing a newer value.
+///
+/// \tparam T The stored value type
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class SlotMap
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Reference to a value of the slot map
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Handle
+    {
+        std::uint32_t index = INVALID;  //<! Index of the slot
+        std::uint32_t generation = 0;   //<! Generation of the slot
+
+        bool operator==(const Handle& other) const = default;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Type definitions
+    ///////////////////////////////////////////////////////////////////////////
+    using Iterator = typename std::vector<T>::iterator;
+    using ConstIterator = typename std::vector<T>::const_iterator;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Slot index of handles that refer to nothing
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr std::uint32_t INVALID = static_cast<std::uint32_t>(-1);
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Indirection from a handle to the dense storage
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Slot
+    {
+        std::uint32_t dense;            //<! Value index, or next free slot
+        std::uint32_t generation;       //<! Incremented on every removal
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private members
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<T> m_values;            //<! Values, densely packed
+    std::vector<std::uint32_t> m_owners; //<! Slot of each value
+    std::vector<Slot> m_slots;          //<! Slots addressed by the handles
+    std::uint32_t m_freeHead;           //<! First free slot, INVALID if none
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor of an empty slot map
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    SlotMap(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Inserts a value
+    ///
+    /// \param value The value to insert
+    ///
+    /// \return The handle of the inserted value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Handle Insert(const T& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Removes a value
+    ///
+    /// The last value is moved into the freed place.
+    ///
+    /// \param handle The handle of the value to remove
+    ///
+    /// \return True if the value was removed, false if the handle is stale
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool Remove(Handle handle);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets a value by its handle
+    ///
+    /// \param handle The handle of the value
+    ///
+    /// \return A pointer to the value, nullptr if the handle is stale
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    T* Get(Handle handle);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets a value by its handle
+    ///
+    /// \param handle The handle of the value
+    ///
+    /// \return A pointer to the value, nullptr if the handle is stale
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const T* Get(Handle handle) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Checks if a handle refers to a stored value
+    ///
+    /// \param handle The handle to check
+    ///
+    /// \return True if the handle is valid, false otherwise
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool Contains(Handle handle) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets the number of stored values
+    ///
+    /// \return The number of values
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t GetSize(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Checks if the slot map is empty
+    ///
+    /// \return True if no value is stored, false otherwise
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool IsEmpty(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Iterators over the values, in storage order
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Iterator begin(void);
+    Iterator end(void);
+    ConstIterator begin(void) const;
+    ConstIterator end(void) const;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets the value index of a handle
+    ///
+    /// \param handle The handle to resolve
+    ///
+    /// \return The index in m_values, INVALID if the handle is stale
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::uint32_t Resolve(Handle handle) const;
+};
+
+} // !namespace Zappy
+
+///////////////////////////////////////////////////////////////////////////////
+// Template implementations
+///////////////////////////////////////////////////////////////////////////////
+#include "Utils/SlotMap.inl"
@@ -0,0 +1,157 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Utils/SlotMap.hpp"
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+namespace Zappy
+{
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+SlotMap<T>::SlotMap(void)
+    : m_freeHead(INVALID)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+typename SlotMap<T>::Handle SlotMap<T>::Insert(const T& value)
+{
+    std::uint32_t index = m_freeHead;
+
+    if (index == INVALID)
+    {
+        index = static_cast<std::uint32_t>(m_slots.size());
+        m_slots.push_back({0, 0});
+    }
+    else
+    {
+        m_freeHead = m_slots[index].dense;
+    }
+
+    m_slots[index].dense = static_cast<std::uint32_t>(m_values.size());
+    m_values.push_back(value);
+    m_owners.push_back(index);
+    return (Handle{index, m_slots[index].generation});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+bool SlotMap<T>::Remove(Handle handle)
+{
+    std::uint32_t dense = Resolve(handle);
+
+    if (dense == INVALID)
+    {
+        return (false);
+    }
+
+    std::uint32_t last = static_cast<std::uint32_t>(m_values.size() - 1);
+
+    if (dense != last)
+    {
+        m_values[dense] = std::move(m_values[last]);
+        m_owners[dense] = m_owners[last];
+        m_slots[m_owners[dense]].dense = dense;
+    }
+    m_values.pop_back();
+    m_owners.pop_back();
+
+    Slot& slot = m_slots[handle.index];
+
+    slot.generation++;
+    slot.dense = m_freeHead;
+    m_freeHead = handle.index;
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+T* SlotMap<T>::Get(Handle handle)
+{
+    std::uint32_t dense = Resolve(handle);
+
+    return (dense == INVALID ? nullptr : &m_values[dense]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+const T* SlotMap<T>::Get(Handle handle) const
+{
+    std::uint32_t dense = Resolve(handle);
+
+    return (dense == INVALID ? nullptr : &m_values[dense]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+bool SlotMap<T>::Contains(Handle handle) const
+{
+    return (Resolve(handle) != INVALID);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+size_t SlotMap<T>::GetSize(void) const
+{
+    return (m_values.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+bool SlotMap<T>::IsEmpty(void) const
+{
+    return (m_values.empty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+typename SlotMap<T>::Iterator SlotMap<T>::begin(void)
+{
+    return (m_values.begin());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+typename SlotMap<T>::Iterator SlotMap<T>::end(void)
+{
+    return (m_values.end());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+typename SlotMap<T>::ConstIterator SlotMap<T>::begin(void) const
+{
+    return (m_values.begin());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+typename SlotMap<T>::ConstIterator SlotMap<T>::end(void) const
+{
+    return (m_values.end());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::uint32_t SlotMap<T>::Resolve(Handle handle) const
+{
+    if (
+        handle.index >= m_slots.size() ||
+        m_slots[handle.index].generation != handle.generation
+    )
+    {
+        return (INVALID);
+    }
+    return (m_slots[handle.index].dense);
+}
+
+} // !namespace Zappy
@@ -0,0 +1,94 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+namespace Zappy
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Bounded lock-free queue between one producer and one consumer
+///
+/// Push is only called by the producer thread and Pop only by the consumer
+/// thread. Each side owns one index and reads the other with acquire
+/// ordering, so neither ever blocks. A full queue rejects the value and
+/// leaves the overflow policy to the producer.
+///
+/// \tparam T The stored value type, default constructible and copyable
+/// \tparam N The capacity, a power of two
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, size_t N>
+class SpscQueue
+{
+    static_assert(N > 0 && (N & (N - 1)) == 0, "Capacity must be a power of 2");
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Size of a cache line, keeping both indices on separate lines
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr size_t CACHE_LINE = 64;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Private members
+    ///////////////////////////////////////////////////////////////////////////
+    alignas(CACHE_LINE) std::atomic<size_t> m_head; //<! Next value to pop
+    alignas(CACHE_LINE) std::atomic<size_t> m_tail; //<! Next slot to fill
+    alignas(CACHE_LINE) std::array<T, N> m_values; //<! Slots
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor of an empty queue
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    SpscQueue(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Appends a value, from the producer thread
+    ///
+    /// \param value The value to append
+    ///
+    /// \return False if the queue is full, in which case nothing is appended
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool Push(const T& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Removes the oldest value, from the consumer thread
+    ///
+    /// \param value Receives the removed value
+    ///
+    /// \return False if the queue is empty
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool Pop(T& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets the number of free slots, from the producer thread
+    ///
+    /// The consumer may free more slots concurrently, never fewer.
+    ///
+    /// \return The number of values that can be pushed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    size_t GetFreeSpace(void) const;
+};
+
+} // !namespace Zappy
+
+///////////////////////////////////////////////////////////////////////////////
+// Template implementations
+///////////////////////////////////////////////////////////////////////////////
+#include "Utils/SpscQueue.inl"
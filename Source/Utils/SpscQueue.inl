@@ -0,0 +1,64 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Utils/SpscQueue.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+namespace Zappy
+{
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, size_t N>
+SpscQueue<T, N>::SpscQueue(void)
+    : m_head(0)
+    , m_tail(0)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, size_t N>
+bool SpscQueue<T, N>::Push(const T& value)
+{
+    size_t tail = m_tail.load(std::memory_order_relaxed);
+
+    if (tail - m_head.load(std::memory_order_acquire) == N)
+    {
+        return (false);
+    }
+    m_values[tail & (N - 1)] = value;
+    m_tail.store(tail + 1, std::memory_order_release);
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, size_t N>
+bool SpscQueue<T, N>::Pop(T& value)
+{
+    size_t head = m_head.load(std::memory_order_relaxed);
+
+    if (head == m_tail.load(std::memory_order_acquire))
+    {
+        return (false);
+    }
+    value = m_values[head & (N - 1)];
+    m_head.store(head + 1, std::memory_order_release);
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, size_t N>
+size_t SpscQueue<T, N>::GetFreeSpace(void) const
+{
+    return (
+        N - (m_tail.load(std::memory_order_relaxed) -
+            m_head.load(std::memory_order_acquire))
+    );
+}
+
+} // !namespace Zappy
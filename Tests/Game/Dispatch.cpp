@@ -0,0 +1,141 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Game/GameState.hpp"
+#include <criterion/criterion.h>
+#include <unordered_map>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <chrono>
+#include <array>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+using namespace Zappy;
+
+///////////////////////////////////////////////////////////////////////////////
+// Lines dispatched by the benchmark, the bulk of a running game
+///////////////////////////////////////////////////////////////////////////////
+static const std::array<std::string, 4> LINES = {
+    "bct 1 2 3 4 5 6 7 8 9",
+    "ppo #12 3 4 1",
+    "pin #12 1 2 1 2 3 4 5 6 7",
+    "bct 9 9 0 0 0 0 0 0 0"
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Number of lines dispatched by each variant
+///////////////////////////////////////////////////////////////////////////////
+static constexpr int DISPATCHES = 2000000;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Parsers reduced to a sum, so only the dispatch is measured
+///
+///////////////////////////////////////////////////////////////////////////////
+struct Handlers
+{
+    std::uint64_t sum = 0;
+
+    [[gnu::noinline]] void Copied(const std::string& args)
+    {
+        sum += args.size();
+    }
+
+    [[gnu::noinline]] void Viewed(std::string_view args)
+    {
+        sum += args.size();
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Nanoseconds per dispatch of a loop
+///////////////////////////////////////////////////////////////////////////////
+template <typename Function>
+static double Measure(Function&& function)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < DISPATCHES; ++i)
+    {
+        function(LINES[i & 3]);
+    }
+    return (
+        std::chrono::duration<double, std::nano>(
+            std::chrono::steady_clock::now() - start
+        ).count() / DISPATCHES
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Dispatch, finds_every_command)
+{
+    for (size_t c = 0; c < static_cast<size_t>(GameState::Command::Count); ++c)
+    {
+        GameState::Command command = static_cast<GameState::Command>(c);
+
+        cr_assert_eq(
+            GameState::FindCommand(GameState::GetCommandName(command)),
+            command
+        );
+    }
+    cr_assert_eq(GameState::FindCommand("xyz"), GameState::Command::Count);
+    cr_assert_eq(GameState::FindCommand("bc"), GameState::Command::Count);
+    cr_assert_eq(GameState::FindCommand("bctt"), GameState::Command::Count);
+    cr_assert_eq(GameState::FindCommand(""), GameState::Command::Count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Dispatch, switch_beats_function_table)
+{
+    Handlers handlers;
+    std::unordered_map<
+        std::string, std::function<void(const std::string&)>
+    > table;
+    std::array<
+        void (Handlers::*)(std::string_view),
+        static_cast<size_t>(GameState::Command::Count)
+    > parsers;
+
+    // The table dispatch replaced by GameState::FindCommand
+    for (size_t c = 0; c < parsers.size(); ++c)
+    {
+        table[GameState::GetCommandName(static_cast<GameState::Command>(c))] =
+            std::bind(&Handlers::Copied, &handlers, std::placeholders::_1);
+        parsers[c] = &Handlers::Viewed;
+    }
+
+    double mapTime = Measure([&](const std::string& line)
+    {
+        auto it = table.find(line.substr(0, 3));
+
+        if (it != table.end())
+        {
+            it->second(line.substr(4));
+        }
+    });
+    double switchTime = Measure([&](std::string_view line)
+    {
+        GameState::Command command = GameState::FindCommand(line.substr(0, 3));
+
+        if (command != GameState::Command::Count)
+        {
+            (handlers.*parsers[static_cast<size_t>(command)])(line.substr(4));
+        }
+    });
+
+    cr_log_info(
+        "map+bind: %.1f ns/dispatch, switch: %.1f ns/dispatch",
+        mapTime, switchTime
+    );
+
+    // Both variants handed every parser the same arguments
+    std::uint64_t expected = 0;
+
+    for (const std::string& line : LINES)
+    {
+        expected += 2 * (line.size() - 4) * (DISPATCHES / LINES.size());
+    }
+    cr_assert_eq(handlers.sum, expected);
+}
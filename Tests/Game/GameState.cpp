@@ -0,0 +1,436 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Game/GameState.hpp"
+#include <criterion/criterion.h>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+using namespace Zappy;
+
+///////////////////////////////////////////////////////////////////////////////
+// Living player of a snapshot by ID, nullptr if none
+///////////////////////////////////////////////////////////////////////////////
+static const Player* FindPlayer(const Snapshot& snapshot, unsigned int id)
+{
+    for (size_t t = 0; t < snapshot.GetTeamCount(); ++t)
+    {
+        for (const auto& player : snapshot.GetTeam(t).GetPlayers())
+        {
+            if (player->GetID() == id)
+            {
+                return (player.get());
+            }
+        }
+    }
+    return (nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Lines rejected for a reason by the parser of a command
+///////////////////////////////////////////////////////////////////////////////
+static std::uint64_t GetErrors(
+    const GameState& state,
+    GameState::Command command,
+    GameState::ParseError error
+)
+{
+    return (
+        state.GetIngestStatistics().errors
+            [static_cast<size_t>(command)][static_cast<size_t>(error)]
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Game with players 1 to count spread over the teams of a 100x100 map
+///////////////////////////////////////////////////////////////////////////////
+static std::string BuildGame(unsigned int count, unsigned int teams)
+{
+    std::string lines = "msz 100 100\n";
+
+    for (unsigned int t = 0; t < teams; ++t)
+    {
+        lines += "tna T" + std::to_string(t) + "\n";
+    }
+    for (unsigned int id = 1; id <= count; ++id)
+    {
+        lines += "pnw #" + std::to_string(id) + " " + std::to_string(id % 100) +
+            " " + std::to_string(id / 100 % 100) + " 1 1 T" +
+            std::to_string(id % teams) + "\n";
+    }
+    return (lines);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Indices of the tiles changed since the last call
+///////////////////////////////////////////////////////////////////////////////
+static std::vector<size_t> TakeDirtyTiles(GameState& state)
+{
+    std::vector<std::uint64_t> dirty;
+    std::vector<size_t> tiles;
+
+    state.ConsumeDirtyTiles(dirty);
+    for (size_t i = 0; i < dirty.size() * 64; ++i)
+    {
+        if (dirty[i / 64] & (std::uint64_t(1) << (i % 64)))
+        {
+            tiles.push_back(i);
+        }
+    }
+    return (tiles);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(GameState, counts_publish_allocations)
+{
+    GameState state;
+
+    state.Replay("msz 4 4\ntna Alpha\npnw #1 1 1 1 1 Alpha\n");
+
+    std::uint64_t first = state.GetIngestStatistics().publishAllocations;
+
+    // Nothing changed, the regions, teams and tables are all shared
+    state.Replay("");
+    cr_assert_gt(first, 0u);
+    cr_assert_lt(state.GetIngestStatistics().publishAllocations, first);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(GameState, removals_keep_the_other_players_reachable)
+{
+    GameState state;
+
+    state.Replay(
+        "msz 10 10\ntna Alpha\n"
+        "pnw #1 0 0 1 1 Alpha\npnw #2 1 0 1 1 Alpha\npnw #3 2 0 1 1 Alpha\n"
+        "pnw #4 3 0 1 1 Alpha\npnw #5 4 0 1 1 Alpha\n"
+    );
+
+    // Removing from the middle and the end moves the last players around
+    state.Replay("pex #2\npdi #5\n");
+    state.Replay("ppo #1 0 5 2\nppo #3 2 5 3\nppo #4 3 5 4\n");
+
+    std::shared_ptr<const Snapshot> snapshot = state.GetSnapshot();
+
+    cr_assert_eq(snapshot->GetLivingPlayers(), 3u);
+    cr_assert_eq(snapshot->GetDeadPlayers(), 2u);
+    cr_assert_eq(snapshot->GetTeam(0).GetLivingPlayers(), 3u);
+    cr_assert_null(FindPlayer(*snapshot, 2));
+    cr_assert_null(FindPlayer(*snapshot, 5));
+    for (unsigned int id : {1u, 3u, 4u})
+    {
+        const Player* player = FindPlayer(*snapshot, id);
+
+        cr_assert_not_null(player);
+        cr_assert_eq(player->GetX(), id - 1);
+        cr_assert_eq(player->GetY(), 5u);
+        cr_assert_eq(player->GetOrientation(), id == 1 ? 2u : id);
+    }
+
+    // Late events about the removed players are rejected, not misapplied
+    state.Replay("ppo #2 9 9 1\npdi #5\npex #2\n");
+    cr_assert_eq(
+        GetErrors(
+            state, GameState::Command::PPO, GameState::ParseError::UnknownPlayer
+        ),
+        1u
+    );
+    cr_assert_eq(
+        GetErrors(
+            state, GameState::Command::PDI, GameState::ParseError::UnknownPlayer
+        ),
+        1u
+    );
+    cr_assert_eq(
+        GetErrors(
+            state, GameState::Command::PEX, GameState::ParseError::UnknownPlayer
+        ),
+        1u
+    );
+    cr_assert_eq(state.GetSnapshot()->GetLivingPlayers(), 3u);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(GameState, rejects_duplicate_player_ids)
+{
+    GameState state;
+
+    state.Replay(
+        "msz 10 10\ntna Alpha\ntna Beta\n"
+        "pnw #1 2 3 1 1 Alpha\npnw #1 7 7 3 4 Beta\n"
+    );
+
+    std::shared_ptr<const Snapshot> snapshot = state.GetSnapshot();
+    const Player* player = FindPlayer(*snapshot, 1);
+
+    cr_assert_eq(
+        GetErrors(state, GameState::Command::PNW, GameState::ParseError::Malformed),
+        1u
+    );
+    cr_assert_eq(snapshot->GetLivingPlayers(), 1u);
+    cr_assert_eq(snapshot->GetTeam(1).GetLivingPlayers(), 0u);
+    cr_assert_not_null(player);
+    cr_assert_eq(player->GetX(), 2u);
+    cr_assert_eq(player->GetLevel(), 1u);
+
+    // Once gone, the ID can be given to a new player
+    state.Replay("pdi #1\npnw #1 7 7 3 4 Beta\n");
+    player = FindPlayer(*state.GetSnapshot(), 1);
+    cr_assert_not_null(player);
+    cr_assert_eq(player->GetTeam(), 1u);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(GameState, player_lookup_throughput)
+{
+    for (unsigned int count : {1000u, 10000u})
+    {
+        GameState state;
+        std::mt19937 random(42);
+        std::string moves;
+        size_t lines = 200000;
+
+        state.Replay(BuildGame(count, 4));
+        for (size_t i = 0; i < lines; ++i)
+        {
+            moves += "ppo #" + std::to_string(random() % count + 1) + " " +
+                std::to_string(random() % 100) + " " +
+                std::to_string(random() % 100) + " " +
+                std::to_string(random() % 4 + 1) + "\n";
+        }
+
+        auto start = std::chrono::steady_clock::now();
+
+        state.Replay(moves);
+
+        double seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start
+        ).count();
+
+        cr_log_info(
+            "%u players: %.2f M ppo lines/s", count, lines / seconds / 1e6
+        );
+        cr_assert_eq(state.GetIngestStatistics().malformedLines, 0u);
+        cr_assert_eq(state.GetSnapshot()->GetLivingPlayers(), count);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(GameState, rejects_trailing_fields)
+{
+    GameState state;
+
+    state.Replay(
+        "msz 10 10\ntna Alpha\npnw #1 2 3 1 1 Alpha\n"
+        "ppo #1 4 5 2 junk\nplv #1 3 4\npin #1 2 3 1 1 1 1 1 1 1 1\n"
+        "bct 1 1 1 1 1 1 1 1 1 1\nsgt 100 2\npnw #2 1 1 1 1 Alpha Beta\n"
+        "ppo #1 6 7 3  \n"
+    );
+
+    const GameState::IngestStatistics& stats = state.GetIngestStatistics();
+    std::shared_ptr<const Snapshot> snapshot = state.GetSnapshot();
+    const Player* player = FindPlayer(*snapshot, 1);
+
+    // Only the line with trailing spaces was applied
+    cr_assert_eq(stats.malformedLines, 6u);
+    cr_assert_not_null(player);
+    cr_assert_eq(player->GetX(), 6u);
+    cr_assert_eq(player->GetY(), 7u);
+    cr_assert_eq(player->GetLevel(), 1u);
+    cr_assert_eq(player->GetInventory().food, 10u);
+    cr_assert_eq(snapshot->GetLivingPlayers(), 1u);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(GameState, ingest_throughput)
+{
+    GameState state;
+    std::mt19937 random(42);
+    std::string lines;
+    size_t count = 200000;
+
+    state.Replay(BuildGame(100, 4));
+    for (size_t i = 0; i < count; ++i)
+    {
+        std::string id = std::to_string(random() % 100 + 1);
+        std::string x = std::to_string(random() % 100);
+        std::string y = std::to_string(random() % 100);
+
+        switch (i % 4)
+        {
+            case 0:
+                lines += "bct " + x + " " + y + " 1 0 2 0 0 1 0\n";
+                break;
+            case 1:
+                lines += "ppo #" + id + " " + x + " " + y + " 1\n";
+                break;
+            case 2:
+                lines += "pin #" + id + " " + x + " " + y + " 9 1 0 2 0 0 1\n";
+                break;
+            default:
+                lines += "plv #" + id + " 2\n";
+                break;
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    state.Replay(lines);
+
+    double seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start
+    ).count();
+
+    cr_log_info("%.2f M lines/s", count / seconds / 1e6);
+    cr_assert_eq(state.GetIngestStatistics().malformedLines, 0u);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(GameState, tracks_dirty_tiles)
+{
+    GameState state;
+
+    // A new map is entirely dirty, once
+    state.Replay("msz 10 7\ntna Alpha\n");
+    cr_assert_eq(TakeDirtyTiles(state).size(), 70u);
+    cr_assert(TakeDirtyTiles(state).empty());
+
+    state.Replay("bct 3 2 1 0 0 0 0 0 0\n");
+    cr_assert(TakeDirtyTiles(state) == std::vector<size_t>{23});
+
+    // Players mark the tiles they appear on, leave and reach
+    state.Replay("pnw #1 1 1 1 1 Alpha\n");
+    cr_assert(TakeDirtyTiles(state) == std::vector<size_t>{11});
+    state.Replay("ppo #1 4 5 1\n");
+    cr_assert((TakeDirtyTiles(state) == std::vector<size_t>{11, 54}));
+    state.Replay("ppo #1 4 5 3\n");
+    cr_assert(TakeDirtyTiles(state) == std::vector<size_t>{54});
+    state.Replay("pdi #1\n");
+    cr_assert(TakeDirtyTiles(state) == std::vector<size_t>{54});
+
+    // Rejected lines change nothing
+    state.Replay("bct 10 0 1 0 0 0 0 0 0\nbct 1 1 1\nppo #1 2 2 1\n");
+    cr_assert(TakeDirtyTiles(state).empty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(GameState, classifies_rejected_lines)
+{
+    using Command = GameState::Command;
+    using Error = GameState::ParseError;
+    GameState state;
+
+    state.Replay(
+        "msz 10 10\ntna Alpha\npnw #1 1 1 1 1 Alpha\n"
+        "pnw #2 1 1 1 1 Beta\nppo #9 1 1 1\nppo #1 x 1 1\n"
+        "pin #9 1 1 0 0 0 0 0 0 0\nplv 1 2\npex #9\n"
+    );
+
+    // Levels run from 1 to 8 and orientations from 1 to 4
+    state.Replay(
+        "pnw #3 1 1 0 1 Alpha\npnw #4 1 1 1 9 Alpha\nppo #1 2 2 5\n"
+        "plv #1 0\nplv #1 9\n"
+    );
+
+    const GameState::IngestStatistics& stats = state.GetIngestStatistics();
+
+    cr_assert_eq(GetErrors(state, Command::PNW, Error::UnknownTeam), 1u);
+    cr_assert_eq(GetErrors(state, Command::PNW, Error::Malformed), 2u);
+    cr_assert_eq(GetErrors(state, Command::PPO, Error::UnknownPlayer), 1u);
+    cr_assert_eq(GetErrors(state, Command::PPO, Error::Malformed), 2u);
+    cr_assert_eq(GetErrors(state, Command::PIN, Error::UnknownPlayer), 1u);
+    cr_assert_eq(GetErrors(state, Command::PLV, Error::Malformed), 3u);
+    cr_assert_eq(GetErrors(state, Command::PEX, Error::UnknownPlayer), 1u);
+
+    // Only the malformed lines count as such
+    cr_assert_eq(stats.malformedLines, 7u);
+
+    std::shared_ptr<const Snapshot> snapshot = state.GetSnapshot();
+    const Player* player = FindPlayer(*snapshot, 1);
+
+    cr_assert_eq(snapshot->GetLivingPlayers(), 1u);
+    cr_assert_eq(player->GetX(), 1u);
+    cr_assert_eq(player->GetOrientation(), 1u);
+    cr_assert_eq(player->GetLevel(), 1u);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(GameState, coalesces_broadcasts_by_tile_and_team)
+{
+    using Type = GameState::AnimationType;
+    GameState state;
+    std::vector<unsigned int> intensities;
+
+    // Columns 0 and 65536 only differ past 16 bits
+    state.Replay(
+        "msz 65537 2\ntna Alpha\ntna Beta\n"
+        "pnw #1 0 1 1 1 Alpha\npnw #2 65536 1 1 1 Alpha\n"
+        "pnw #3 0 1 1 1 Beta\npnw #4 0 1 1 1 Alpha\n"
+    );
+    while (state.PopAnimation())
+    {
+    }
+    state.Replay(
+        "pbc #1 a\npbc #2 b\npbc #3 c\npbc #4 d\npbc #1 e\n"
+        "pic 65537 0 1 #1\npie 0 2 1\n"
+    );
+    while (auto event = state.PopAnimation())
+    {
+        cr_assert(event->type == Type::Broadcast);
+        intensities.push_back(event->intensity);
+    }
+
+    // The same tile and team merge, the incantations off the map are
+    // rejected
+    cr_assert(intensities == std::vector<unsigned int>({3, 1, 1}));
+    cr_assert_eq(state.GetIngestStatistics().coalescedAnimations, 2u);
+    cr_assert_eq(state.GetIngestStatistics().malformedLines, 2u);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(GameState, edits_players_while_snapshots_are_read)
+{
+    GameState state;
+    std::atomic<bool> done = false;
+    std::atomic<unsigned int> torn = 0, reads = 0;
+
+    state.Replay("msz 10 10\ntna Alpha\npnw #1 0 0 1 1 Alpha\n");
+
+    // Every move keeps x equal to y, and a published player never changes
+    std::thread reader([&]()
+    {
+        while (!done.load())
+        {
+            std::shared_ptr<const Snapshot> snapshot = state.GetSnapshot();
+            const Player* player = FindPlayer(*snapshot, 1);
+            unsigned int x = player->GetX();
+
+            for (int i = 0; i < 100; ++i)
+            {
+                if (player->GetX() != x || player->GetY() != x)
+                {
+                    torn++;
+                }
+            }
+            reads++;
+        }
+    });
+
+    for (unsigned int i = 0; i < 20000 || reads.load() < 100; ++i)
+    {
+        std::string k = std::to_string(i % 10);
+
+        state.Replay("ppo #1 " + k + " " + k + " 1\n");
+    }
+    done = true;
+    reader.join();
+    cr_assert_eq(torn.load(), 0u);
+    cr_assert_eq(state.GetIngestStatistics().malformedLines, 0u);
+}
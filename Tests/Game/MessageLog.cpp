@@ -0,0 +1,170 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Game/MessageLog.hpp"
+#include <criterion/criterion.h>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+using namespace Zappy;
+
+///////////////////////////////////////////////////////////////////////////////
+// Free text of every message kept, oldest first
+///////////////////////////////////////////////////////////////////////////////
+static std::vector<std::string> GetPayloads(const MessageLog& log)
+{
+    std::vector<std::string> payloads;
+
+    log.ForEach([&](const Message& message)
+    {
+        payloads.emplace_back(log.GetPayload(message));
+    });
+    return (payloads);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(MessageLog, merges_lanes_by_age)
+{
+    MessageLog log;
+    std::vector<std::string> newest;
+
+    log.Push(Message(Message::Event::Broadcast, 1), "a");
+    log.Push(Message(Message::Event::Victory), "b");
+    log.Push(Message(Message::Event::Broadcast, 2), "c");
+    log.Push(Message(Message::Event::Victory), "d");
+
+    cr_assert_eq(log.GetSize(), 4u);
+    cr_assert(GetPayloads(log) == std::vector<std::string>({"a", "b", "c", "d"}));
+
+    log.ForEachNewest([&](const Message& message)
+    {
+        newest.emplace_back(log.GetPayload(message));
+    });
+    cr_assert(newest == std::vector<std::string>({"d", "c", "b", "a"}));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(MessageLog, evicts_oldest_segments)
+{
+    MessageLog log;
+    size_t pushed = 10 * MessageLog::CAPACITY + 7;
+
+    for (size_t i = 0; i < pushed; ++i)
+    {
+        log.Push(Message(Message::Event::Broadcast), std::to_string(i));
+    }
+
+    std::vector<std::string> payloads = GetPayloads(log);
+
+    cr_assert_eq(log.GetSize(), MessageLog::CAPACITY);
+    cr_assert_eq(payloads.size(), MessageLog::CAPACITY);
+    for (size_t i = 0; i < payloads.size(); ++i)
+    {
+        cr_assert_eq(
+            payloads[i], std::to_string(pushed - MessageLog::CAPACITY + i)
+        );
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(MessageLog, important_lane_survives_a_flood)
+{
+    MessageLog log;
+
+    log.Push(Message(Message::Event::Victory), "winner");
+    for (size_t i = 0; i < 5 * MessageLog::CAPACITY; ++i)
+    {
+        log.Push(Message(Message::Event::Broadcast), "spam");
+    }
+
+    std::vector<std::string> payloads = GetPayloads(log);
+
+    cr_assert_eq(log.GetSize(), MessageLog::CAPACITY + 1);
+    cr_assert_eq(payloads.front(), "winner");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(MessageLog, keeps_text_larger_than_a_block)
+{
+    MessageLog log;
+    std::string large(3 * MessageLog::TEXT_BLOCK_SIZE, 'x');
+
+    log.Push(Message(Message::Event::Broadcast), "before");
+    log.Push(Message(Message::Event::Broadcast), large);
+    log.Push(Message(Message::Event::Broadcast), "after");
+    log.Push(Message(Message::Event::Broadcast));
+
+    std::vector<std::string> payloads = GetPayloads(log);
+
+    cr_assert(payloads == std::vector<std::string>({"before", large, "after", ""}));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(MessageLog, shared_log_ignores_later_pushes)
+{
+    MessageLog log;
+    std::vector<std::shared_ptr<const MessageLog>> shares;
+    std::vector<std::vector<std::string>> expected;
+
+    // Share at every step, across segment boundaries and evictions
+    for (size_t i = 0; i < 3 * MessageLog::CAPACITY; ++i)
+    {
+        log.Push(Message(Message::Event::Broadcast), std::to_string(i));
+        if (i % 13 == 0)
+        {
+            shares.push_back(log.Share());
+            expected.push_back(GetPayloads(log));
+        }
+    }
+
+    for (size_t i = 0; i < shares.size(); ++i)
+    {
+        cr_assert(GetPayloads(*shares[i]) == expected[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(MessageLog, shared_log_is_read_while_pushing)
+{
+    static constexpr size_t COUNT = 20 * MessageLog::CAPACITY;
+    MessageLog log;
+    std::shared_ptr<const MessageLog> shared = log.Share();
+    std::atomic<bool> done = false;
+    size_t wrong = 0;
+
+    // The reader walks the latest share while the writer keeps appending
+    // into the segments that share still holds
+    std::thread reader([&]()
+    {
+        while (!done.load(std::memory_order_acquire))
+        {
+            std::shared_ptr<const MessageLog> current =
+                std::atomic_load(&shared);
+            std::vector<std::string> payloads = GetPayloads(*current);
+
+            for (size_t i = 1; i < payloads.size(); ++i)
+            {
+                wrong += std::stoul(payloads[i]) !=
+                    std::stoul(payloads[i - 1]) + 1;
+            }
+        }
+    });
+
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        log.Push(Message(Message::Event::Broadcast), std::to_string(i));
+        if (i % 7 == 0)
+        {
+            std::atomic_store(&shared, log.Share());
+        }
+    }
+    done.store(true, std::memory_order_release);
+    reader.join();
+    cr_assert_eq(wrong, 0u);
+}
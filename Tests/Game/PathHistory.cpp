@@ -0,0 +1,150 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Game/PathHistory.hpp"
+#include <criterion/criterion.h>
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+using namespace Zappy;
+
+///////////////////////////////////////////////////////////////////////////////
+// Sequence of positions
+///////////////////////////////////////////////////////////////////////////////
+using Path = std::vector<std::pair<unsigned int, unsigned int>>;
+
+///////////////////////////////////////////////////////////////////////////////
+// Every position of a history, oldest first
+///////////////////////////////////////////////////////////////////////////////
+static Path Collect(const PathHistory& history)
+{
+    Path path;
+
+    history.ForEach([&](unsigned int x, unsigned int y)
+    {
+        path.emplace_back(x, y);
+    });
+    return (path);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Walk in the 16-bit range mixing steps, map wraps and far jumps
+///////////////////////////////////////////////////////////////////////////////
+static Path Walk(size_t length, unsigned int seed)
+{
+    std::mt19937 random(seed);
+    Path path;
+    int x = 0, y = 0;
+
+    for (size_t i = 0; i < length; ++i)
+    {
+        switch (random() % 8)
+        {
+            case 0:
+                // Wrap around a 30x20 map, or the whole 16-bit range
+                x = x == 0 ? 29 : 0;
+                y = y == 0xFFFF ? 0 : 0xFFFF;
+                break;
+            case 1:
+                x = random() % 0x10000;
+                y = random() % 0x10000;
+                break;
+            default:
+                x += static_cast<int>(random() % 7) - 3;
+                y += static_cast<int>(random() % 7) - 3;
+                x = std::clamp(x, 0, 0xFFFF);
+                y = std::clamp(y, 0, 0xFFFF);
+                break;
+        }
+        path.emplace_back(x, y);
+    }
+    return (path);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(PathHistory, round_trips_past_the_ring)
+{
+    for (size_t length : {size_t(1), size_t(64), size_t(65), size_t(5000)})
+    {
+        PathHistory history;
+        Path path = Walk(length, static_cast<unsigned int>(length));
+        Path recent;
+
+        for (auto [x, y] : path)
+        {
+            history.Push(x, y);
+        }
+        history.ForEachRecent([&](unsigned int x, unsigned int y)
+        {
+            recent.emplace_back(x, y);
+        });
+
+        size_t kept = std::min(length, PathHistory::DEFAULT_CAPACITY);
+
+        cr_assert_eq(history.GetSize(), length);
+        cr_assert_eq(history.GetRecentCount(), kept);
+        cr_assert(Collect(history) == path, "length %zu", length);
+        cr_assert(Path(path.end() - kept, path.end()) == recent);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(PathHistory, seals_blocks)
+{
+    PathHistory history;
+    Path path;
+
+    // Every step after the first is one byte, so blocks fill predictably
+    for (unsigned int i = 0; i < 4 * PathHistory::BLOCK_SIZE; ++i)
+    {
+        path.emplace_back(i % 50, i / 50);
+        history.Push(i % 50, i / 50);
+    }
+    cr_assert_gt(history.GetCompressedSize(), PathHistory::BLOCK_SIZE);
+    cr_assert_lt(history.GetCompressedSize(), 2 * path.size());
+    cr_assert(Collect(history) == path);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(PathHistory, wraps_a_small_ring)
+{
+    PathHistory::SetDefaultCapacity(3);
+
+    PathHistory history;
+    Path path = Walk(10, 7);
+
+    for (size_t i = 0; i < path.size(); ++i)
+    {
+        history.Push(path[i].first, path[i].second);
+        cr_assert(Collect(history) == Path(path.begin(), path.begin() + i + 1));
+        cr_assert_eq(history.GetRecentCount(), std::min<size_t>(i + 1, 3));
+    }
+    PathHistory::SetDefaultCapacity(PathHistory::DEFAULT_CAPACITY);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(PathHistory, copies_are_independent)
+{
+    PathHistory history;
+    Path path = Walk(3000, 3);
+
+    for (auto [x, y] : path)
+    {
+        history.Push(x, y);
+    }
+
+    // The copy shares the sealed blocks but not the ring or the open block
+    PathHistory copy = history;
+
+    copy.Push(1, 2);
+    history.Push(3, 4);
+    path.emplace_back(3, 4);
+    cr_assert(Collect(history) == path);
+    path.back() = {1, 2};
+    cr_assert(Collect(copy) == path);
+}
@@ -0,0 +1,54 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Game/Team.hpp"
+#include <criterion/criterion.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+using namespace Zappy;
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Team, edits_unshared_player_in_place)
+{
+    Team team("Alpha");
+    Team::PlayerHandle handle = team.AddPlayer(Player(1, 2, 3, 1, 1, 0));
+    const Player* before = team.GetPlayer(handle);
+
+    cr_assert_eq(team.EditPlayer(handle), before);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Team, copy_keeps_players_edited_afterwards)
+{
+    Team team("Alpha");
+    Team::PlayerHandle first = team.AddPlayer(Player(1, 2, 3, 1, 1, 0));
+    Team::PlayerHandle second = team.AddPlayer(Player(2, 4, 5, 1, 1, 0));
+    Team copy(team);
+    Tokenizer plv("7");
+
+    // The copy shares both players until one of them is written
+    cr_assert_eq(copy.GetPlayer(first), team.GetPlayer(first));
+    cr_assert(team.EditPlayer(first)->UpdateLevel(plv));
+
+    cr_assert_eq(team.GetPlayer(first)->GetLevel(), 7u);
+    cr_assert_eq(copy.GetPlayer(first)->GetLevel(), 1u);
+    cr_assert_neq(copy.GetPlayer(first), team.GetPlayer(first));
+    cr_assert_eq(copy.GetPlayer(second), team.GetPlayer(second));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Team, removal_keeps_copied_player)
+{
+    Team team("Alpha");
+    Team::PlayerHandle handle = team.AddPlayer(Player(1, 2, 3, 1, 1, 0));
+    Team copy(team);
+
+    team.RemovePlayer(handle);
+
+    cr_assert_null(team.GetPlayer(handle));
+    cr_assert_eq(team.GetDeadPlayersCount(), 1u);
+    cr_assert_not_null(copy.GetPlayer(handle));
+    cr_assert_eq(copy.GetPlayer(handle)->GetID(), 1u);
+}
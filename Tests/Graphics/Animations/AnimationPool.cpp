@@ -0,0 +1,170 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Graphics/Animations/AnimationPool.hpp"
+#include <criterion/criterion.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+using namespace Zappy;
+
+///////////////////////////////////////////////////////////////////////////////
+// Start a ring on a tile, lasting for a duration
+///////////////////////////////////////////////////////////////////////////////
+static void Spawn(
+    AnimationPool& pool,
+    std::uint32_t tile,
+    float duration,
+    std::uint32_t group = 0
+)
+{
+    pool.Spawn(
+        AnimationPool::Shape::Ring, tile, group,
+        static_cast<float>(tile), 0.f, 10.f, duration, sf::Color::Red
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(AnimationPool, removes_finished_animations_in_any_order)
+{
+    AnimationPool pool;
+
+    Spawn(pool, 0, 1.f);
+    Spawn(pool, 1, 3.f);
+    Spawn(pool, 2, 2.f);
+    Spawn(pool, 3, 1.f);
+    cr_assert_eq(pool.GetSize(), 4u);
+
+    // The first and the last finish together, the middle ones stay
+    pool.Update(1.5f);
+    cr_assert_eq(pool.GetSize(), 2u);
+    pool.Update(1.f);
+    cr_assert_eq(pool.GetSize(), 1u);
+    pool.Update(1.f);
+    cr_assert(pool.IsEmpty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(AnimationPool, moved_animations_keep_their_state)
+{
+    AnimationPool pool;
+
+    // Odd tiles last 1.05s, 1.15s, ... so one finishes every 0.1s
+    for (std::uint32_t tile = 0; tile < 100; ++tile)
+    {
+        Spawn(pool, tile, tile % 2 == 0 ? 0.5f : 1.05f + (tile / 2) * 0.1f);
+    }
+
+    // The even ones are replaced by odd ones moved from the end, whose
+    // durations and elapsed times must follow them
+    pool.Update(0.75f);
+    cr_assert_eq(pool.GetSize(), 50u);
+    pool.Update(0.25f);
+    cr_assert_eq(pool.GetSize(), 50u);
+    for (std::uint32_t step = 1; step <= 50; ++step)
+    {
+        pool.Update(0.1f);
+        cr_assert_eq(pool.GetSize(), 50u - step, "step %u", step);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(AnimationPool, clear_empties_the_pool)
+{
+    AnimationPool pool;
+
+    Spawn(pool, 0, 1.f);
+    Spawn(pool, 1, 1.f);
+    pool.Clear();
+    cr_assert(pool.IsEmpty());
+
+    // The tile counts were reset as well
+    for (int i = 0; i < 4; ++i)
+    {
+        Spawn(pool, 0, 1.f, i);
+    }
+    cr_assert_eq(pool.GetSize(), 4u);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(AnimationPool, merges_within_the_window)
+{
+    AnimationPool pool;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        Spawn(pool, 0, 1.f);
+    }
+    cr_assert_eq(pool.GetSize(), 1u);
+
+    // Other groups and shapes of the same tile are kept apart
+    Spawn(pool, 0, 1.f, 1);
+    pool.Spawn(
+        AnimationPool::Shape::Square, 0, 0, 0.f, 0.f, 10.f, 1.f,
+        sf::Color::Red
+    );
+    cr_assert_eq(pool.GetSize(), 3u);
+
+    // Past the window, the same event starts a new animation
+    pool.Update(0.3f);
+    Spawn(pool, 0, 1.f);
+    cr_assert_eq(pool.GetSize(), 4u);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(AnimationPool, caps_the_animations_of_a_tile)
+{
+    AnimationPool pool;
+
+    // Past the window every spawn would start a new animation, until the
+    // tile holds MAX_PER_TILE of them
+    for (int i = 0; i < 10; ++i)
+    {
+        Spawn(pool, 0, 100.f);
+        pool.Update(0.3f);
+    }
+    cr_assert_eq(pool.GetSize(), 4u);
+
+    // A full tile drops the events it has nothing to merge with
+    Spawn(pool, 0, 100.f, 1);
+    cr_assert_eq(pool.GetSize(), 4u);
+    Spawn(pool, 1, 100.f, 1);
+    cr_assert_eq(pool.GetSize(), 5u);
+
+    // The tile accepts new animations once its own have finished
+    pool.Clear();
+    for (int i = 0; i < 4; ++i)
+    {
+        Spawn(pool, 0, 1.f, i);
+    }
+    pool.Update(2.f);
+    Spawn(pool, 0, 1.f, 7);
+    cr_assert_eq(pool.GetSize(), 1u);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(AnimationPool, keeps_merge_targets_across_removals)
+{
+    AnimationPool pool;
+
+    // The second animation is moved into the place of the first one
+    Spawn(pool, 0, 0.1f);
+    Spawn(pool, 1, 10.f);
+    pool.Update(0.2f);
+    Spawn(pool, 1, 10.f);
+    cr_assert_eq(pool.GetSize(), 1u);
+
+    // Its merge target follows it, instead of the newer animation now in
+    // its old place, so the event past its window starts a new one
+    pool.Update(0.1f);
+    Spawn(pool, 3, 10.f);
+    Spawn(pool, 1, 10.f);
+    cr_assert_eq(pool.GetSize(), 3u);
+
+    // A finished target is forgotten rather than aliasing another one
+    Spawn(pool, 2, 0.1f);
+    pool.Update(0.15f);
+    Spawn(pool, 2, 10.f);
+    cr_assert_eq(pool.GetSize(), 4u);
+}
@@ -0,0 +1,102 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Graphics/PlayerBatch.hpp"
+#include "Game/GameState.hpp"
+#include "Utils/AllocationCounter.hpp"
+#include <criterion/criterion.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+using namespace Zappy;
+
+///////////////////////////////////////////////////////////////////////////////
+// Three teams sharing a 10x10 map, with a crowded tile at (2, 2)
+///////////////////////////////////////////////////////////////////////////////
+static constexpr const char* GAME =
+    "msz 10 10\n"
+    "tna Alpha\n"
+    "tna Beta\n"
+    "tna Gamma\n"
+    "pnw #1 2 2 1 1 Alpha\n"
+    "pnw #2 2 2 2 1 Beta\n"
+    "pnw #3 2 2 2 1 Gamma\n"
+    "pnw #4 5 7 3 1 Alpha\n"
+    "pnw #5 9 9 4 1 Beta\n"
+    "pnw #6 0 4 1 1 Gamma\n";
+
+///////////////////////////////////////////////////////////////////////////////
+// Vertices of a triangle marker and of a circle marker
+///////////////////////////////////////////////////////////////////////////////
+static constexpr size_t TRIANGLE_VERTICES = 3;
+static constexpr size_t CIRCLE_VERTICES = 3 * (12 - 2);
+
+///////////////////////////////////////////////////////////////////////////////
+Test(PlayerBatch, one_marker_per_orientation_and_tile)
+{
+    GameState state;
+    PlayerBatch batch(128.f);
+
+    state.Replay(GAME);
+    batch.Build(*state.GetSnapshot(), 0, 0, 10, 10);
+
+    // The crowded tile shows two orientations, the others one each
+    cr_assert_eq(
+        batch.GetVertices().getVertexCount(),
+        5 * TRIANGLE_VERTICES + 4 * CIRCLE_VERTICES
+    );
+
+    batch.Build(*state.GetSnapshot(), 0, 0, 3, 3);
+    cr_assert_eq(
+        batch.GetVertices().getVertexCount(),
+        2 * TRIANGLE_VERTICES + CIRCLE_VERTICES
+    );
+
+    batch.Build(*state.GetSnapshot(), 3, 3, 3, 3);
+    cr_assert_eq(batch.GetVertices().getVertexCount(), 0u);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(PlayerBatch, frames_do_not_allocate)
+{
+    GameState state;
+    PlayerBatch batch(128.f);
+
+    state.Replay(GAME);
+
+    std::shared_ptr<const Snapshot> snapshot = state.GetSnapshot();
+
+    // The first frame sizes the buffers
+    batch.Build(*snapshot, 0, 0, 10, 10);
+
+    std::uint64_t before = AllocationCounter::GetThreadCount();
+
+    for (int frame = 0; frame < 100; ++frame)
+    {
+        batch.Build(*snapshot, 0, 0, 10, 10);
+    }
+    cr_assert_eq(AllocationCounter::GetThreadCount(), before);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(PlayerBatch, moves_do_not_allocate_frames)
+{
+    GameState state;
+    PlayerBatch batch(128.f);
+
+    state.Replay(GAME);
+    batch.Build(*state.GetSnapshot(), 0, 0, 10, 10);
+
+    // Players walking around keep the same number of markers
+    state.Replay("ppo #4 6 7 3\nppo #5 9 8 4\n");
+
+    std::shared_ptr<const Snapshot> snapshot = state.GetSnapshot();
+    std::uint64_t before = AllocationCounter::GetThreadCount();
+
+    for (int frame = 0; frame < 100; ++frame)
+    {
+        batch.Build(*snapshot, 0, 0, 10, 10);
+    }
+    cr_assert_eq(AllocationCounter::GetThreadCount(), before);
+}
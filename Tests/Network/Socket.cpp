@@ -0,0 +1,138 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Network/Socket.hpp"
+#include <criterion/criterion.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <string>
+#include <string_view>
+#include <thread>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+using namespace Zappy;
+
+///////////////////////////////////////////////////////////////////////////////
+// Connected pair, the socket under test reads what the peer writes
+///////////////////////////////////////////////////////////////////////////////
+struct Pair
+{
+    Socket socket;
+    int peer;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Open a connected pair of local stream sockets
+///////////////////////////////////////////////////////////////////////////////
+static Pair OpenPair(void)
+{
+    int fds[2];
+
+    cr_assert_eq(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+    return (Pair{Socket(fds[0]), fds[1]});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Write all of the data to a descriptor
+///////////////////////////////////////////////////////////////////////////////
+static void Write(int fd, std::string_view data)
+{
+    while (!data.empty())
+    {
+        ssize_t written = ::write(fd, data.data(), data.size());
+
+        cr_assert_gt(written, 0);
+        data.remove_prefix(static_cast<size_t>(written));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Socket, joins_a_line_split_across_reads)
+{
+    Pair pair = OpenPair();
+    std::string_view line;
+
+    Write(pair.peer, "msz 1");
+    cr_assert_eq(pair.socket.Fill(), 5);
+    cr_assert_not(pair.socket.PopLine(line));
+
+    // The unfinished part is kept, not scanned again
+    Write(pair.peer, "0 10\n");
+    cr_assert_eq(pair.socket.Fill(), 5);
+    cr_assert(pair.socket.PopLine(line));
+    cr_assert(line == "msz 10 10");
+    cr_assert_not(pair.socket.PopLine(line));
+
+    // The peer closing is reported once the buffer is drained
+    ::close(pair.peer);
+    cr_assert_eq(pair.socket.Fill(), 0);
+    cr_assert_not(pair.socket.IsValid());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Socket, strips_carriage_returns)
+{
+    Pair pair = OpenPair();
+    std::string_view line;
+
+    Write(pair.peer, "sgt 100\r\n\r\nb\rc\n");
+    pair.socket.Fill();
+    cr_assert(pair.socket.PopLine(line));
+    cr_assert(line == "sgt 100");
+    cr_assert(pair.socket.PopLine(line));
+    cr_assert(line.empty());
+
+    // Only the one ending the line is dropped
+    cr_assert(pair.socket.PopLine(line));
+    cr_assert(line == "b\rc");
+    ::close(pair.peer);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Socket, pops_every_line_of_a_read)
+{
+    Pair pair = OpenPair();
+    std::string_view line;
+
+    Write(pair.peer, "pnw #1\nppo #1\npdi #1\npex");
+    pair.socket.Fill();
+    for (const char* expected : {"pnw #1", "ppo #1", "pdi #1"})
+    {
+        cr_assert(pair.socket.PopLine(line));
+        cr_assert(line == expected);
+    }
+    cr_assert_not(pair.socket.PopLine(line));
+    cr_assert_eq(pair.socket.GetStatistics().lines, 3u);
+
+    Write(pair.peer, " #2\n");
+    pair.socket.Fill();
+    cr_assert(pair.socket.PopLine(line));
+    cr_assert(line == "pex #2");
+    ::close(pair.peer);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Socket, grows_the_buffer_for_long_lines)
+{
+    Pair pair = OpenPair();
+    std::string_view line;
+    std::string large(300 * 1024, 'x');
+
+    // The long line starts behind a consumed one, so it is moved to the
+    // front of the buffer before the buffer grows past its first size
+    std::thread writer([&]()
+    {
+        Write(pair.peer, "first\n");
+        Write(pair.peer, large);
+        Write(pair.peer, "\nlast\n");
+    });
+
+    cr_assert(pair.socket.RecvLine() == "first");
+    cr_assert(pair.socket.RecvLine() == large);
+    cr_assert(pair.socket.RecvLine() == "last");
+    writer.join();
+    cr_assert_eq(pair.socket.GetStatistics().bytes, large.size() + 12);
+    ::close(pair.peer);
+}
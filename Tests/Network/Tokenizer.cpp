@@ -0,0 +1,189 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Network/Tokenizer.hpp"
+#include <criterion/criterion.h>
+#include <sstream>
+#include <string>
+#include <chrono>
+#include <array>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+using namespace Zappy;
+
+///////////////////////////////////////////////////////////////////////////////
+// Arguments parsed by the benchmark, a bct and a pin without their command
+///////////////////////////////////////////////////////////////////////////////
+static const std::array<std::string, 2> ARGUMENTS = {
+    "12 34 1 0 2 0 0 1 0",
+    "#42 3 4 10 1 0 2 0 0 1"
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Number of lines parsed by each variant
+///////////////////////////////////////////////////////////////////////////////
+static constexpr int LINES = 1000000;
+
+///////////////////////////////////////////////////////////////////////////////
+// Lines per second parsed by a loop
+///////////////////////////////////////////////////////////////////////////////
+template <typename Function>
+static double Measure(Function&& function)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < LINES; ++i)
+    {
+        function(ARGUMENTS[i & 1]);
+    }
+    return (
+        LINES / std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start
+        ).count()
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Tokenizer, reads_ids_and_numbers)
+{
+    Tokenizer tok("#12  34 word rest of  the line");
+    unsigned int id = 0, number = 0;
+    std::string_view word;
+
+    cr_assert(tok.ReadID(id));
+    cr_assert(tok.ReadUnsigned(number));
+    cr_assert(tok.ReadWord(word));
+    cr_assert_eq(id, 12u);
+    cr_assert_eq(number, 34u);
+    cr_assert(word == "word");
+    cr_assert_not(tok.AtEnd());
+    cr_assert(tok.ReadRest() == "rest of  the line");
+    cr_assert(tok.AtEnd());
+    cr_assert_not(tok.HasFailed());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Tokenizer, rejects_malformed_ids)
+{
+    for (const char* line : {"12", "#", "#-1", "#1a", "# 1", "##1"})
+    {
+        Tokenizer tok(line);
+        unsigned int id = 7;
+
+        cr_assert_not(tok.ReadID(id), "%s", line);
+        cr_assert_eq(tok.GetError(), Tokenizer::Error::Malformed, "%s", line);
+        cr_assert_eq(id, 7u, "%s", line);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Tokenizer, reports_overflow)
+{
+    Tokenizer max("4294967295 #4294967295");
+    Tokenizer number("4294967296");
+    Tokenizer id("#99999999999999999999");
+    unsigned int value = 0;
+
+    cr_assert(max.ReadUnsigned(value));
+    cr_assert_eq(value, 4294967295u);
+    cr_assert(max.ReadID(value));
+    cr_assert_eq(value, 4294967295u);
+
+    value = 7;
+    cr_assert_not(number.ReadUnsigned(value));
+    cr_assert_eq(number.GetError(), Tokenizer::Error::Overflow);
+    cr_assert_not(id.ReadID(value));
+    cr_assert_eq(id.GetError(), Tokenizer::Error::Overflow);
+    cr_assert_eq(value, 7u);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Tokenizer, reports_missing_fields)
+{
+    Tokenizer tok("  3   ");
+    unsigned int x = 0, y = 7;
+    std::string_view word;
+
+    cr_assert(tok.ReadUnsigned(x));
+    cr_assert(tok.AtEnd());
+    cr_assert_not(tok.ReadUnsigned(y));
+    cr_assert_eq(tok.GetError(), Tokenizer::Error::Missing);
+    cr_assert_eq(y, 7u);
+
+    // Empty lines lack their first field as well
+    Tokenizer empty("");
+
+    cr_assert_not(empty.ReadWord(word));
+    cr_assert_eq(empty.GetError(), Tokenizer::Error::Missing);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Tokenizer, keeps_the_first_error)
+{
+    Tokenizer tok("-3 4");
+    unsigned int x = 0, y = 0;
+
+    cr_assert_not(tok.ReadUnsigned(x));
+    cr_assert_not(tok.ReadUnsigned(y));
+    cr_assert_not(tok.ReadUnsigned(y));
+    cr_assert_eq(tok.GetError(), Tokenizer::Error::Malformed);
+    cr_assert_eq(y, 0u);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Tokenizer, leaves_trailing_fields_to_at_end)
+{
+    Tokenizer tok("#1 2 3 4 junk");
+    unsigned int id, x, y, orientation;
+
+    tok.ReadID(id);
+    tok.ReadUnsigned(x);
+    tok.ReadUnsigned(y);
+    tok.ReadUnsigned(orientation);
+    cr_assert_not(tok.HasFailed());
+    cr_assert_not(tok.AtEnd());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Tokenizer, parse_throughput)
+{
+    std::uint64_t streamSum = 0, tokenSum = 0;
+
+    // The istringstream parsing replaced by the tokenizer
+    double streamRate = Measure([&](const std::string& line)
+    {
+        std::istringstream iss(line);
+        unsigned int value;
+
+        if (iss.peek() == '#')
+        {
+            iss.ignore();
+        }
+        while (iss >> value)
+        {
+            streamSum += value;
+        }
+    });
+    double tokenRate = Measure([&](const std::string& line)
+    {
+        Tokenizer tok(line);
+        unsigned int value;
+
+        if (line[0] == '#' && tok.ReadID(value))
+        {
+            tokenSum += value;
+        }
+        while (!tok.AtEnd() && tok.ReadUnsigned(value))
+        {
+            tokenSum += value;
+        }
+    });
+
+    cr_log_info(
+        "istringstream: %.2f M lines/s, tokenizer: %.2f M lines/s",
+        streamRate / 1e6, tokenRate / 1e6
+    );
+    cr_assert_eq(tokenSum, streamSum);
+}
@@ -0,0 +1,56 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Utils/Expected.hpp"
+#include <criterion/criterion.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+using namespace Zappy;
+
+///////////////////////////////////////////////////////////////////////////////
+// Value reached through operator->
+///////////////////////////////////////////////////////////////////////////////
+struct Point
+{
+    int x;
+    int y;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Expected, holds_a_value_or_an_error)
+{
+    Expected<Point, int> value(Point{3, 4});
+    Expected<Point, int> error(Unexpected<int>(42));
+
+    cr_assert(value.HasValue());
+    cr_assert(static_cast<bool>(value));
+    cr_assert_eq(value.GetValue().x, 3);
+    cr_assert_eq(value->y, 4);
+
+    cr_assert_not(error.HasValue());
+    cr_assert_not(static_cast<bool>(error));
+    cr_assert_eq(error.GetError(), 42);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Expected, value_is_writable)
+{
+    Expected<int, int> result(1);
+
+    result.GetValue() = 2;
+    cr_assert_eq(result.GetValue(), 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(Expected, void_results_report_success_or_an_error)
+{
+    Expected<void, int> success;
+    Expected<void, int> failure(Unexpected<int>(7));
+
+    cr_assert(success.HasValue());
+    cr_assert(static_cast<bool>(success));
+    cr_assert_not(failure.HasValue());
+    cr_assert_eq(failure.GetError(), 7);
+}
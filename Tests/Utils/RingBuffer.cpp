@@ -0,0 +1,83 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Utils/RingBuffer.hpp"
+#include <criterion/criterion.h>
+#include <algorithm>
+#include <memory>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+using namespace Zappy;
+
+///////////////////////////////////////////////////////////////////////////////
+Test(RingBuffer, keeps_the_newest_values_in_order)
+{
+    RingBuffer<int> ring(4);
+
+    for (int i = 0; i < 11; ++i)
+    {
+        ring.Push(i);
+
+        size_t size = std::min<size_t>(i + 1, 4);
+
+        cr_assert_eq(ring.GetSize(), size);
+        for (size_t age = 0; age < size; ++age)
+        {
+            cr_assert_eq(ring[age], i + 1 - static_cast<int>(size - age));
+        }
+    }
+    cr_assert_eq(ring.GetCapacity(), 4u);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(RingBuffer, clear_restarts_from_the_oldest)
+{
+    RingBuffer<std::string> ring(3);
+
+    for (const char* value : {"a", "b", "c", "d", "e"})
+    {
+        ring.Push(value);
+    }
+    ring.Clear();
+    cr_assert_eq(ring.GetSize(), 0u);
+
+    ring.Push("f");
+    ring.Push("g");
+    cr_assert(ring[0] == "f");
+    cr_assert(ring[1] == "g");
+
+    // Indexing is writable and follows the rotation
+    ring[1] = "h";
+    ring.Push("i");
+    ring.Push("j");
+    cr_assert(ring[0] == "h");
+    cr_assert(ring[2] == "j");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(RingBuffer, releases_evicted_values)
+{
+    RingBuffer<std::shared_ptr<int>> ring(2);
+    auto first = std::make_shared<int>(1);
+
+    ring.Push(first);
+    ring.Push(std::make_shared<int>(2));
+    cr_assert_eq(first.use_count(), 2);
+    ring.Push(std::make_shared<int>(3));
+    cr_assert_eq(first.use_count(), 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(RingBuffer, capacity_is_at_least_one)
+{
+    RingBuffer<int> ring(0);
+
+    ring.Push(1);
+    ring.Push(2);
+    cr_assert_eq(ring.GetCapacity(), 1u);
+    cr_assert_eq(ring.GetSize(), 1u);
+    cr_assert_eq(ring[0], 2);
+}
@@ -0,0 +1,104 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Utils/SlotMap.hpp"
+#include <criterion/criterion.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+using namespace Zappy;
+
+///////////////////////////////////////////////////////////////////////////////
+Test(SlotMap, handles_survive_other_removals)
+{
+    SlotMap<int> map;
+    auto a = map.Insert(1);
+    auto b = map.Insert(2);
+    auto c = map.Insert(3);
+
+    // Removing the first value moves the last one into its place
+    cr_assert(map.Remove(a));
+    cr_assert_eq(map.GetSize(), 2u);
+    cr_assert_eq(*map.Get(b), 2);
+    cr_assert_eq(*map.Get(c), 3);
+    cr_assert_eq(*map.begin(), 3);
+    cr_assert_null(map.Get(a));
+    cr_assert_not(map.Contains(a));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(SlotMap, stale_handles_do_not_alias_reused_slots)
+{
+    SlotMap<int> map;
+    auto old = map.Insert(1);
+
+    cr_assert(map.Remove(old));
+
+    auto reused = map.Insert(2);
+
+    // The slot is reused with a new generation
+    cr_assert_eq(reused.index, old.index);
+    cr_assert_neq(reused.generation, old.generation);
+    cr_assert_null(map.Get(old));
+    cr_assert_not(map.Remove(old));
+    cr_assert_eq(*map.Get(reused), 2);
+    cr_assert_eq(map.GetSize(), 1u);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(SlotMap, default_handles_refer_to_nothing)
+{
+    SlotMap<int> map;
+    SlotMap<int>::Handle none;
+
+    map.Insert(1);
+    cr_assert_eq(none.index, SlotMap<int>::INVALID);
+    cr_assert_null(map.Get(none));
+    cr_assert_not(map.Remove(none));
+    cr_assert_null(map.Get(SlotMap<int>::Handle{5, 0}));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(SlotMap, matches_a_reference_under_random_churn)
+{
+    SlotMap<int> map;
+    std::vector<std::pair<SlotMap<int>::Handle, int>> live;
+    std::vector<SlotMap<int>::Handle> dead;
+    std::mt19937 random(42);
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        if (live.empty() || random() % 3 != 0)
+        {
+            live.emplace_back(map.Insert(i), i);
+            continue;
+        }
+
+        size_t victim = random() % live.size();
+
+        cr_assert(map.Remove(live[victim].first));
+        dead.push_back(live[victim].first);
+        live[victim] = live.back();
+        live.pop_back();
+    }
+
+    std::vector<int> stored(map.begin(), map.end());
+    std::vector<int> expected;
+
+    for (const auto& [handle, value] : live)
+    {
+        cr_assert_eq(*map.Get(handle), value);
+        expected.push_back(value);
+    }
+    for (const auto& handle : dead)
+    {
+        cr_assert_not(map.Contains(handle));
+    }
+    std::sort(stored.begin(), stored.end());
+    std::sort(expected.begin(), expected.end());
+    cr_assert(stored == expected);
+}
@@ -0,0 +1,99 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Utils/SpscQueue.hpp"
+#include <criterion/criterion.h>
+#include <cstdint>
+#include <thread>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Zappy
+///////////////////////////////////////////////////////////////////////////////
+using namespace Zappy;
+
+///////////////////////////////////////////////////////////////////////////////
+Test(SpscQueue, rejects_pushes_when_full)
+{
+    SpscQueue<int, 4> queue;
+    int value = -1;
+
+    cr_assert_not(queue.Pop(value));
+    cr_assert_eq(value, -1);
+    cr_assert_eq(queue.GetFreeSpace(), 4u);
+    for (int i = 0; i < 4; ++i)
+    {
+        cr_assert(queue.Push(i));
+    }
+    cr_assert_eq(queue.GetFreeSpace(), 0u);
+    cr_assert_not(queue.Push(4));
+
+    // The rejected value was not appended
+    for (int i = 0; i < 4; ++i)
+    {
+        cr_assert(queue.Pop(value));
+        cr_assert_eq(value, i);
+    }
+    cr_assert_not(queue.Pop(value));
+    cr_assert_eq(queue.GetFreeSpace(), 4u);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(SpscQueue, keeps_order_across_wraps)
+{
+    SpscQueue<int, 4> queue;
+    int pushed = 0, popped = 0, value;
+
+    // Uneven bursts move the indices through every slot many times
+    for (int round = 0; round < 100; ++round)
+    {
+        for (int i = 0; i < round % 4 + 1 && queue.Push(pushed); ++i)
+        {
+            pushed++;
+        }
+        for (int i = 0; i < round % 3 + 1 && queue.Pop(value); ++i)
+        {
+            cr_assert_eq(value, popped++);
+        }
+        cr_assert_eq(queue.GetFreeSpace(), 4u - (pushed - popped));
+    }
+    while (queue.Pop(value))
+    {
+        cr_assert_eq(value, popped++);
+    }
+    cr_assert_eq(popped, pushed);
+    cr_assert_gt(pushed, 100);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Test(SpscQueue, transfers_between_threads)
+{
+    static constexpr std::uint64_t COUNT = 1000000;
+    SpscQueue<std::uint64_t, 64> queue;
+    std::uint64_t expected = 0;
+    bool ordered = true;
+
+    std::thread consumer([&]()
+    {
+        std::uint64_t value;
+
+        while (expected < COUNT)
+        {
+            if (queue.Pop(value))
+            {
+                ordered = ordered && value == expected;
+                expected++;
+            }
+        }
+    });
+
+    for (std::uint64_t i = 0; i < COUNT;)
+    {
+        if (queue.Push(i))
+        {
+            i++;
+        }
+    }
+    consumer.join();
+    cr_assert(ordered);
+    cr_assert_eq(expected, COUNT);
+}